@@ -90,6 +90,7 @@ struct BenjolinOsc : BenjolinModule {
     configOutput(RUNG_OUTPUT,"Rungler");
     
     oversampleStages = 5;
+    watchdogAvailable = true;
   }
 
   void onSampleRateChange() override {
@@ -198,6 +199,14 @@ struct BenjolinOsc : BenjolinModule {
       else
         outA = osc*5.f;
     }
+    if (watchdogEnabled && (watchdog(osc) | watchdog(outA) | watchdog(outB))) {
+      osc = {0.f, 0.f, 1.f, 1.f};
+      dir = {1.f, 1.f, 0.f, 0.f};
+      in = outA = outB = simd::float_4::zero();
+      upSample.reset();
+      downSampleA.reset();
+      downSampleB.reset();
+    }
     trig = 0;
     if (clockTrig.isHigh() != oldTrig){
       trig = clockTrig.isHigh() ? 1 : -1;
@@ -40,6 +40,11 @@ class OversampleFilter {
       return x;
     }
 
+    void reset() {
+      for (int i=0; i<5; i++)
+        f[i].reset();
+    }
+
   private:
     rack::dsp::TBiquadFilter<float> f[5]{};
 };
@@ -47,6 +52,7 @@ class OversampleFilter {
 class OversampleFilter_4 {
   public:
     int stages = 3;
+    float latency = 0.f; // group delay at DC in base rate samples
     void setOversample(int oversample, int stageCnt = 3) {
       stages = stageCnt;
       float cutoff = 1.f / oversample;
@@ -72,6 +78,15 @@ class OversampleFilter_4 {
           f[3].setParameters(rack::dsp::TBiquadFilter<rack::simd::float_4>::LOWPASS, cutoff, 1.1013f, 1);
           f[4].setParameters(rack::dsp::TBiquadFilter<rack::simd::float_4>::LOWPASS, cutoff, 3.1970f, 1);
       }
+      // The DC group delay of each lowpass section is 1 - (a1 + 2 a2) / (1 + a1 + a2) samples
+      latency = 0.f;
+      for (int i=0; i<stages; i++) {
+        float a1 = f[i].a[0], a2 = f[i].a[1];
+        latency += 1.f - (a1 + 2.f*a2) / (1.f + a1 + a2);
+      }
+      latency /= oversample;
+      over = oversample;
+      primeValid = false;
     }
 
     rack::simd::float_4 process(rack::simd::float_4 x) {
@@ -80,76 +95,239 @@ class OversampleFilter_4 {
       return x;
     }
 
+    void reset() {
+      for (int i=0; i<5; i++)
+        f[i].reset();
+    }
+
+    // Sets every section to the state it settles to when upsampling a held input x.
+    // An upsampler is fed a zero-stuffed signal (x*oversample, then oversample-1 zeros), so its
+    // steady state is periodic rather than constant. The state at the start of a period scales
+    // with x, so it is computed once for a unit input after each setOversample(), and a filter that
+    // resumes after being bypassed starts where it would have been had it run all along.
+    void prime(rack::simd::float_4 x) {
+      if (!primeValid)
+        computePrime();
+      for (int i=0; i<stages; i++) {
+        for (int j=0; j<2; j++) {
+          f[i].x[j] = x * primeX[i][j];
+          f[i].y[j] = x * primeY[i][j];
+        }
+      }
+    }
+
   private:
     rack::dsp::TBiquadFilter<rack::simd::float_4> f[5]{};
+    int over = 1;
+    bool primeValid = false;
+    float primeX[5][2]{}, primeY[5][2]{};
+
+    // Run a copy of the cascade on a zero-stuffed unit input, one period at a time,
+    // until its state at the start of a period stops changing
+    void computePrime() {
+      rack::dsp::TBiquadFilter<float> g[5];
+      for (int i=0; i<stages; i++) {
+        for (int j=0; j<3; j++)
+          g[i].b[j] = f[i].b[j];
+        for (int j=0; j<2; j++)
+          g[i].a[j] = f[i].a[j];
+      }
+      for (int period=0; period<200; period++) {
+        float prev = g[stages-1].y[0];
+        for (int o=0; o<over; o++) {
+          float x = o ? 0.f : static_cast<float>(over);
+          for (int i=0; i<stages; i++)
+            x = g[i].process(x);
+        }
+        if (std::fabs(g[stages-1].y[0] - prev) <= 1e-7f * std::fabs(prev))
+          break;
+      }
+      for (int i=0; i<stages; i++) {
+        for (int j=0; j<2; j++) {
+          primeX[i][j] = g[i].x[j];
+          primeY[i][j] = g[i].y[j];
+        }
+      }
+      primeValid = true;
+    }
 };
 
-/*
 class DCBlockFilter_4 {
-// This version is mysteriously not working on some machines
-// Be sure to uncomment `, oversample` in process calls if reverting to this version
+// Sample rate aware version whose cutoff stays close to 7.6 Hz at any sample rate and oversample rate.
+// The leak coefficient k is computed by the owning module via coefficient() only when the
+// sample rate or oversample rate changes, and is shared by all of that module's DC blockers.
+// The leak is applied as val - k*val, which keeps more precision at high effective rates
+// than multiplying by a pole 1-k that lies very close to 1.
   public:
-    rack::simd::float_4 val() {
-      return prevY;
+    rack::simd::float_4 val = rack::simd::float_4::zero();
+
+    // k = 48/rate gives the original 0.999 pole at 48 kHz (about 7.6 Hz cutoff),
+    // and approximately the same time constant at other rates
+    static float coefficient(float sampleRate, int over = 1) {
+      return 48.f / (sampleRate * over);
     }
     
-    rack::simd::float_4 process( rack::simd::float_4 x, int over = 1 ) {
-      float r = 1.f - 250.f / rack::settings::sampleRate / static_cast<float>(over);
-      rack::simd::float_4 y = x - prevX + static_cast<rack::simd::float_4>(r) * prevY;
+    rack::simd::float_4 process( rack::simd::float_4 x, float k ) {
+      val += x - prevX - static_cast<rack::simd::float_4>(k) * val;
+      prevX = x;
+      return val;
+    }
+
+    void reset() {
+      val = prevX = rack::simd::float_4::zero();
+    }
+
+    // Sets the state a held input x settles to, so resuming on x produces no step
+    void prime(rack::simd::float_4 x) {
+      val = rack::simd::float_4::zero();
       prevX = x;
-      prevY = y;
-      return y;
     }
   
   private:
     rack::simd::float_4 prevX = rack::simd::float_4::zero();
-    rack::simd::float_4 prevY = rack::simd::float_4::zero();
 };
-*/
 
-/*
-class DCBlockFilter_4 {
-// This version is mysteriously not working on some machines
-// But I really like the behavior when it does.
-//  - Minimal bass attenuation
-//  - Consistent at all sample rates and oversampling rates
-//  - Excellent DC offset filtering
-// Be sure to uncomment `, oversample` in process calls if reverting to this version
+class SyncBLEP_4 {
+// Corrects the discontinuity of a sub-sample hard sync reset with a 2 sample polyBLEP residual.
+// The output is delayed by one sample so the residual can be applied on both sides of the reset.
+// The step height is estimated as the difference between the new sample and a linear extrapolation
+// of the two uncorrected samples before the reset, so it works for any waveform shape.
   public:
-    rack::simd::float_4 val() {
-      return rtn;
+    // sync is a mask of lanes that reset during this sample.
+    // p is the fraction of this sample that elapsed after the reset, in the range [0, 1].
+    rack::simd::float_4 process( rack::simd::float_4 x, rack::simd::float_4 sync, rack::simd::float_4 p ) {
+      rack::simd::float_4 h = rack::simd::ifelse(sync, x - 2.f*raw1 + raw2, rack::simd::float_4::zero());
+      rack::simd::float_4 q = 1.f - p;
+      rack::simd::float_4 y = held + h * p * p * 0.5f;
+      held = x - h * q * q * 0.5f;
+      raw2 = raw1;
+      raw1 = x;
+      return y;
     }
-    
-    rack::simd::float_4 process( rack::simd::float_4 x, int over = 1 ) {
-      double r = 1. - 100. / static_cast<double>(rack::settings::sampleRate) / static_cast<double>(over);
-      for (int i=0; i<4; i++){
-        double y = static_cast<double>(x[i]) - prevX[i] + r * prevY[i];
-        prevX[i] = static_cast<double>(x[i]);
-        prevY[i] = y;
-        rtn[i] = static_cast<float>(y);
-      }
-      return rtn;
+
+    void reset() {
+      held = raw1 = raw2 = rack::simd::float_4::zero();
     }
   
   private:
-    double prevX[4]{};
-    double prevY[4]{};
-    rack::simd::float_4 rtn = rack::simd::float_4::zero();
+    rack::simd::float_4 held = rack::simd::float_4::zero();
+    rack::simd::float_4 raw1 = rack::simd::float_4::zero();
+    rack::simd::float_4 raw2 = rack::simd::float_4::zero();
 };
-*/
 
-class DCBlockFilter_4 {
-// Naive version that doesn't adjust for sample rate or oversampling, so cutoff is not consistent
-// Also attenuates bass tones too much as sample rate and/or oversampling rate rises
+class AudioRateDetector {
+// Decides whether an input carries audio rate content that needs to be oversampled.
+// For each channel the mean square slope (first difference in V/s) and the mean square deviation from
+// a slow running mean are smoothed with 50 ms one pole filters. Their ratio is the squared angular
+// frequency of a sine, so the decision depends on how fast the input moves and not on its level.
+// A channel above about 50 Hz, or with gate edges, counts as audio, and the decision has hysteresis.
+// A small level floor keeps silent and near silent inputs slow.
+// After a reset or a channel count change the input counts as audio until the estimates have settled
+// for 50 ms, so a caller can reset the detector whenever it skips an input instead of leaving its state stale.
   public:
-    rack::simd::float_4 val = rack::simd::float_4::zero();
-    
-    rack::simd::float_4 process( rack::simd::float_4 x ) {
-      val = x - prevX + static_cast<rack::simd::float_4>(0.999f) * val;
-      prevX = x;
-      return val;
+    bool audio = true;
+
+    bool process(rack::engine::Input& input, float sampleRate) {
+      int channels = input.getChannels();
+      float k = std::min(20.f / sampleRate, 1.f);
+      if (settle < 0 || channels != prevChannels) {
+        settle = static_cast<int>(sampleRate * 0.05f);
+        prevChannels = channels;
+        for (int c=0, s=0; c<channels; c+=4, s++) {
+          prevX[s] = mean[s] = input.getVoltageSimd<rack::simd::float_4>(c);
+          slope[s] = level[s] = rack::simd::float_4::zero();
+        }
+      }
+      float thresh = audio ? lowThresh : highThresh;
+      bool fast = false;
+      for (int c=0, s=0; c<channels; c+=4, s++) {
+        rack::simd::float_4 x = input.getVoltageSimd<rack::simd::float_4>(c);
+        rack::simd::float_4 d = (x - prevX[s]) * sampleRate;
+        prevX[s] = x;
+        mean[s] += (x - mean[s]) * (k * 0.25f);
+        rack::simd::float_4 ac = x - mean[s];
+        slope[s] += (d * d - slope[s]) * k;
+        level[s] += (ac * ac - level[s]) * k;
+        int mask = channels - c < 4 ? (1 << (channels - c)) - 1 : 15;
+        fast |= rack::simd::movemask(slope[s] > (level[s] + levelFloor) * thresh) & mask;
+      }
+      if (settle > 0)
+        settle--;
+      else
+        audio = fast;
+      return audio;
     }
-  
+
+    void reset() {
+      audio = true;
+      settle = -1;
+    }
+
   private:
-    rack::simd::float_4 prevX = rack::simd::float_4::zero();
-};
\ No newline at end of file
+    const float highThresh = 4.f * M_PI * M_PI * 50.f * 50.f; // (2 pi 50 Hz)^2
+    const float lowThresh = 4.f * M_PI * M_PI * 25.f * 25.f;
+    const float levelFloor = 1e-8f; // V^2, about 0.1 mV rms
+    int settle = -1, prevChannels = 0;
+    rack::simd::float_4 prevX[4]{}, mean[4]{}, slope[4]{}, level[4]{};
+};
+
+class SmartPathSelector {
+// Chooses between processing paths numbered in order of increasing cost, such as no oversampling,
+// partial, and full oversampling, and crossfades each change over fadeLen samples while the prior
+// path keeps running. A costlier path is taken as soon as it is wanted, but a cheaper one only once
+// it has been wanted for holdTime. The hold bounds how much time a chattering decision can spend
+// running two paths, and is kept short because the costly path it holds on to is the expensive one.
+// Wanting the prior path back during a crossfade reverses the fade, so a change is never blocked
+// by a fade in the other direction.
+  public:
+    static const int fadeLen = 256;
+    float holdTime = 0.02f; // seconds
+    int path = -1, prev = 0; // path -1 = stopped
+    int fade = 0; // samples left in the crossfade from prev to path
+
+    // Starts with path p already running, so it needs no crossfade
+    void start(int p) {
+      path = p;
+      fade = wait = 0;
+    }
+
+    // Call once per sample with the wanted path, after start().
+    // Returns true when a new path starts, whose state the caller should clear.
+    bool process(int want, float sampleRate) {
+      if (fade)
+        fade--;
+      if (want >= path)
+        wait = static_cast<int>(holdTime * sampleRate);
+      else if (wait > 0) {
+        wait--;
+        want = path;
+      }
+      if (want == path)
+        return false;
+      if (fade && want == prev) {
+        prev = path;
+        path = want;
+        fade = fadeLen - fade;
+        return false;
+      }
+      if (fade)
+        return false;
+      prev = path;
+      path = want;
+      fade = fadeLen;
+      return true;
+    }
+
+    // Weight of the prior path in the crossfade
+    float fadeGain() {
+      return static_cast<float>(fade) / fadeLen;
+    }
+
+    void reset() {
+      path = -1;
+      fade = 0;
+    }
+
+  private:
+    int wait = 0;
+};
@@ -55,6 +55,8 @@ struct Logic : VenomModule {
   OversampleFilter   highUpSample, lowUpSample;
   OversampleFilter_4 aUpSample[CHANNEL_COUNT][4], bUpSample[CHANNEL_COUNT][4], outDownSample[CHANNEL_COUNT][4];
   DCBlockFilter_4 dcBlock[CHANNEL_COUNT][4];
+  float dcBlockCoef = 0.001f;
+  float sampleRate = 48000.f;
   simd::float_4 aState[CHANNEL_COUNT][4]{}, bState[CHANNEL_COUNT][4]{};
   
   Logic() {
@@ -95,7 +97,13 @@ struct Logic : VenomModule {
     oversampleStages = 5;
   }
   
+  void onSampleRateChange(const SampleRateChangeEvent& e) override {
+    sampleRate = e.sampleRate;
+    setOversample();
+  }
+
   void setOversample() override {
+    dcBlockCoef = DCBlockFilter_4::coefficient(sampleRate);
     highUpSample.setOversample(oversample, oversampleStages);
     lowUpSample.setOversample(oversample, oversampleStages);
     for (int c=0; c<CHANNEL_COUNT; c++){
@@ -250,7 +258,7 @@ struct Logic : VenomModule {
       for (int c=0; c<endChannel; c++) {
         for (int p=0, pi=0; p<polyCount[c]; p+=4, pi++) {
           if (dc) {
-            outVal[c][pi] = dcBlock[c][pi].process(outVal[c][pi]/*, oversample*/);
+            outVal[c][pi] = dcBlock[c][pi].process(outVal[c][pi], dcBlockCoef);
           }  
           outputs[GATE_OUTPUT+c].setVoltageSimd(outVal[c][pi], p);
         }
@@ -35,6 +35,8 @@ struct Mix4 : MixBaseModule {
   int oversample = 4;
   OversampleFilter_4 outUpSample[4]{}, outDownSample[4]{};
   DCBlockFilter_4 dcBlockBeforeFilter[4]{}, dcBlockAfterFilter[4]{};
+  float dcBlockCoef = 0.001f;
+  float sampleRate = 48000.f;
 
   Mix4() {
     venomConfig(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -54,10 +56,17 @@ struct Mix4 : MixBaseModule {
                                                                                          "Saturate (Soft oversampled post-level at 6V)"});
     configOutput(MIX_OUTPUT, "Mix");
     oversampleStages = 5;
+    watchdogAvailable = true;
+    setOversample();
+  }
+
+  void onSampleRateChange(const SampleRateChangeEvent& e) override {
+    sampleRate = e.sampleRate;
     setOversample();
   }
 
   void setOversample() override {
+    dcBlockCoef = DCBlockFilter_4::coefficient(sampleRate);
     for (int i=0; i<4; i++){
       outUpSample[i].setOversample(oversample, oversampleStages);
       outDownSample[i].setOversample(oversample, oversampleStages);
@@ -248,7 +257,7 @@ struct Mix4 : MixBaseModule {
         if (offsetExpander) out += offsetExpander->params[POST_MIX_OFFSET_PARAM].getValue();
       }
       if (dcBlock && dcBlock <= 2) // no oversample applied during DC removal
-        out = dcBlockBeforeFilter[c/4].process(out);
+        out = dcBlockBeforeFilter[c/4].process(out, dcBlockCoef);
       if (clip == 1 || clip == 4)
         out = clamp(out, -10.f, 10.f);
       if (clip == 2 || clip == 5)
@@ -261,14 +270,23 @@ struct Mix4 : MixBaseModule {
         }
       }
       if (dcBlock == 3 || (dcBlock == 2 && clip)) // no oversample applied during DC removal
-        out = dcBlockAfterFilter[c/4].process(out);
+        out = dcBlockAfterFilter[c/4].process(out, dcBlockCoef);
       if (clip > 3 && clip < 7){
         out *= (params[MIX_LEVEL_PARAM].getValue()+offset)*scale;
         if (offsetExpander) out += offsetExpander->params[POST_MIX_OFFSET_PARAM].getValue();
       }
       out *= fadeLevel[4]; // Mix fade factor
+      if (watchdogEnabled && watchdog(out)) {
+        outUpSample[c/4].reset();
+        outDownSample[c/4].reset();
+        dcBlockBeforeFilter[c/4].reset();
+        dcBlockAfterFilter[c/4].reset();
+        out = simd::float_4::zero();
+      }
       outputs[MIX_OUTPUT].setVoltageSimd(out, c);
     }
+    if (watchdogEnabled)
+      watchdogFades();
     outputs[MIX_OUTPUT].setChannels(channels);
   }
 
@@ -38,6 +38,8 @@ struct Mix4Stereo : MixBaseModule {
   OversampleFilter_4 leftUpSample[4]{}, leftDownSample[4]{}, rightUpSample[4]{}, rightDownSample[4]{};
   DCBlockFilter_4 leftDcBlockBeforeFilter[4]{}, rightDcBlockBeforeFilter[4]{},
                   leftDcBlockAfterFilter[4]{},  rightDcBlockAfterFilter[4]{};
+  float dcBlockCoef = 0.001f;
+  float sampleRate = 48000.f;
 
   Mix4Stereo() {
     venomConfig(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -60,10 +62,17 @@ struct Mix4Stereo : MixBaseModule {
     configOutput(LEFT_OUTPUT, "Left Mix");
     configOutput(RIGHT_OUTPUT, "Right Mix");
     oversampleStages = 5;
+    watchdogAvailable = true;
+    setOversample();
+  }
+
+  void onSampleRateChange(const SampleRateChangeEvent& e) override {
+    sampleRate = e.sampleRate;
     setOversample();
   }
 
   void setOversample() override {
+    dcBlockCoef = DCBlockFilter_4::coefficient(sampleRate);
     for (int i=0; i<4; i++){
       leftUpSample[i].setOversample(oversample, oversampleStages);
       leftDownSample[i].setOversample(oversample, oversampleStages);
@@ -343,8 +352,8 @@ struct Mix4Stereo : MixBaseModule {
         rightOut *= (params[MIX_LEVEL_PARAM].getValue()+offset)*scale + postMixOff;
       }
       if (dcBlock && dcBlock <= 2){ // no oversample applied during DC removal
-        leftOut = leftDcBlockBeforeFilter[c/4].process(leftOut);
-        rightOut = rightDcBlockBeforeFilter[c/4].process(rightOut);
+        leftOut = leftDcBlockBeforeFilter[c/4].process(leftOut, dcBlockCoef);
+        rightOut = rightDcBlockBeforeFilter[c/4].process(rightOut, dcBlockCoef);
       }
       if (clip == 1 || clip ==4){
         leftOut = clamp(leftOut, -10.f, 10.f);
@@ -365,8 +374,8 @@ struct Mix4Stereo : MixBaseModule {
         }
       }
       if (dcBlock == 3 || (dcBlock == 2 && clip)){ // no oversample applied during DC removal
-        leftOut = leftDcBlockAfterFilter[c/4].process(leftOut);
-        rightOut = rightDcBlockAfterFilter[c/4].process(rightOut);
+        leftOut = leftDcBlockAfterFilter[c/4].process(leftOut, dcBlockCoef);
+        rightOut = rightDcBlockAfterFilter[c/4].process(rightOut, dcBlockCoef);
       }
       if (clip > 3 && clip < 7) {
         leftOut *= (params[MIX_LEVEL_PARAM].getValue()+offset)*scale + postMixOff;
@@ -374,9 +383,22 @@ struct Mix4Stereo : MixBaseModule {
       }
       leftOut  *= fadeLevel[4]; // Mix fade factor
       rightOut *= fadeLevel[4]; // Mix fade factor
+      if (watchdogEnabled && (watchdog(leftOut) | watchdog(rightOut))) {
+        leftUpSample[c/4].reset();
+        leftDownSample[c/4].reset();
+        rightUpSample[c/4].reset();
+        rightDownSample[c/4].reset();
+        leftDcBlockBeforeFilter[c/4].reset();
+        rightDcBlockBeforeFilter[c/4].reset();
+        leftDcBlockAfterFilter[c/4].reset();
+        rightDcBlockAfterFilter[c/4].reset();
+        leftOut = rightOut = simd::float_4::zero();
+      }
       outputs[LEFT_OUTPUT].setVoltageSimd(leftOut, c);
       outputs[RIGHT_OUTPUT].setVoltageSimd(rightOut, c);
     }
+    if (watchdogEnabled)
+      watchdogFades();
     outputs[LEFT_OUTPUT].setChannels(channels);
     outputs[RIGHT_OUTPUT].setChannels(channels);
   }
@@ -237,6 +237,18 @@ struct MixBaseModule : MixModule {
     }
   }
 
+  // Reset any fade slew limiter (own or send expander) whose state is no longer finite
+  void watchdogFades() {
+    for (int i=0; i<5; i++) {
+      if (watchdog(fade[i].out))
+        fade[i].out = 0.f;
+    }
+    for (unsigned int x=0; x<expanders.size(); x++) {
+      if (watchdog(expanders[x]->fade[0].out))
+        expanders[x]->fade[0].out = 0.f;
+    }
+  }
+
   json_t* dataToJson() override {
     json_t* rootJ = VenomModule::dataToJson();
     json_object_set_new(rootJ, "softMute", json_boolean(softMute));
@@ -181,6 +181,7 @@ struct Oscillator : VenomModule {
 
   bool clampLevel = true;
   bool disableDPW = false;
+  bool polyBlep = false;
   bool disableOver[INPUTS_LEN]{};
   bool unity5[5]{};
   bool bipolar[5]{};
@@ -190,17 +191,38 @@ struct Oscillator : VenomModule {
   float shpScale[4]{0.2f, 0.2f, 0.2f, 0.2f};
   bool softSync = false;
   bool alternate = false;
-  bool aliasSuppress = false;
+  int antiAlias = 0; // 0 = off, 1 = DPW, 2 = polyBLEP/polyBLAMP
   using float_4 = simd::float_4;
   int oversample = -1;
   std::vector<int> oversampleValues = {1,2,4,8,16,32};
   OversampleFilter_4 expUpSample[4]{}, linUpSample[4]{}, revUpSample[4]{}, syncUpSample[4]{},
                      shapeUpSample[4][5]{}, phaseUpSample[4][5]{}, offsetUpSample[4][5]{}, levelUpSample[4][5]{},
                      outDownSample[4][5]{};
-  float_4 phasor[4]{}, phasorDir[4]{1.f, 1.f, 1.f, 1.f};
+  simd::int32_4 phase[4]{}; // 32 bit fixed point phase accumulator
+  float_4 phasor[4]{}, phasorDir[4]{1.f, 1.f, 1.f, 1.f}; // phase converted to [0, 1000) for shape math
   DCBlockFilter_4 dcBlockFilter[4][6]{}; // Sin, Tri, Sqr, Saw, Mix, Lin FM Input
+  float dcBlockCoef = 0.001f;
+  float sampleRate = 48000.f; // engine rate from the last sample rate event, so nothing here reads APP
   bool linDCCouple = false;
   dsp::SchmittTrigger syncTrig[16], revTrig[16];
+  bool subSampleSync = false;
+  float syncPrev[16]{}, syncFrac[16]{};
+  int syncStep[16]{}; // oversample step of a pending sub-sample sync + 1, 0 = none pending
+  SyncBLEP_4 syncBlep[4][5]{};
+  // Block pitch conversion: when oversampling, exp2 is computed once per sample from the
+  // V/Oct and exponential FM inputs, and the frequency is interpolated across the sub-samples
+  bool pitchBlockInterp = false;
+  bool pitchBlockReset = true;
+  float_4 pitchPrev[4]{}, pitchNext[4]{};
+  // One shot groups skipped while silent, groups whose outputs settled to silence, and the first
+  // group that ran in the last sample, which read the monophonic input values for the others
+  bool groupSkip[4]{}, groupQuiet[4]{};
+  int groupFirst = 0;
+  // Automatic input oversampling: connected inputs that only carry slow CV are held across the
+  // sub-samples instead of being run through the upsample filters
+  bool autoOver = false;
+  bool autoSlow[INPUTS_LEN]{};
+  AudioRateDetector overDetector[INPUTS_LEN]{};
   float modeFreq[3] = {dsp::FREQ_C4, 2.f, 100.f}, biasFreq = 0.02f;
   int currentMode = -1;
   int mode = 0;
@@ -209,6 +231,14 @@ struct Oscillator : VenomModule {
   bool gated = false;
   float_4 onceActive[4]{};
   int modeDefaultOver[3] = {2, 0, 2};
+  // Control rate engine for the low frequency modes: waveforms are computed every lfoDivision
+  // samples without oversampling, and the outputs ramp along the slope predicted from the last
+  // two computed values. After a jump the next compute runs one sample later to measure the slope.
+  static const int lfoDivision = 16;
+  bool lfoControlRate = false;
+  bool lfoRate = false, lfoJump = false, lfoResume = false;
+  int lfoSamples = 0, lfoNext = lfoDivision, lfoChannels = 1, lfoOnceMask = 0;
+  float_4 lfoOut[4][5]{}, lfoStep[4][5]{}, lfoPrev[4][5]{};
   
   struct PWQuantity : ParamQuantity {
     float getDisplayValue() override {
@@ -313,18 +343,15 @@ struct Oscillator : VenomModule {
     }
     
     oversampleStages = 5;
+    watchdogAvailable = true;
+    lutDivider.setDivision(256);
   }
 
-  float_4 sinSimd_1000(float_4 t) {
-    t = simd::ifelse(t > 500.f, 1000.f - t, t) * 0.002f - 0.5f;
-    float_4 t2 = t * t;
-    return -(((-0.540347 * t2 + 2.53566) * t2 - 5.16651) * t2 + 3.14159) * t;
-  }
-  
   void setMode(bool aliasSuppressOnly = false) {
     currentMode = static_cast<int>(params[MODE_PARAM].getValue());
     mode = currentMode>5 ? 1 : currentMode>2 ? 0 : currentMode;
-    aliasSuppress = !mode && !disableDPW;
+    // DPW is unstable at low frequencies so it is limited to the audio modes, but polyBLEP works in any mode
+    antiAlias = polyBlep ? 2 : (mode || disableDPW) ? 0 : 1;
     if (aliasSuppressOnly)
       return;
     if (!paramExtensions[OVER_PARAM].locked)
@@ -353,7 +380,47 @@ struct Oscillator : VenomModule {
     shpScale[indx] = val ? 0.1f : 0.2f;
   }
   
+  void onSampleRateChange(const SampleRateChangeEvent& e) override {
+    sampleRate = e.sampleRate;
+    setOversample();
+  }
+
+  // Upsampling filter of an input for group s, or NULL if the input has none
+  OversampleFilter_4* inputUpSample(int id, int s) {
+    if (id >= SIN_SHAPE_INPUT && id <= MIX_SHAPE_INPUT) return &shapeUpSample[s][id - SIN_SHAPE_INPUT];
+    if (id >= SIN_PHASE_INPUT && id <= MIX_PHASE_INPUT) return &phaseUpSample[s][id - SIN_PHASE_INPUT];
+    if (id >= SIN_OFFSET_INPUT && id <= MIX_OFFSET_INPUT) return &offsetUpSample[s][id - SIN_OFFSET_INPUT];
+    if (id >= SIN_LEVEL_INPUT && id <= MIX_LEVEL_INPUT) return &levelUpSample[s][id - SIN_LEVEL_INPUT];
+    switch (id) {
+      case EXP_INPUT:  return &expUpSample[s];
+      case LIN_INPUT:  return &linUpSample[s];
+      case SYNC_INPUT: return &syncUpSample[s];
+      case REV_INPUT:  return &revUpSample[s];
+      default:         return NULL;
+    }
+  }
+
+  // Brings the filters of a skipped one shot group back to the current input values. When monoOnly,
+  // the group is already running and only takes over reading the monophonic inputs from a skipped group.
+  void resumeGroup(int s, int c, bool* procOver, bool monoOnly) {
+    for (int i=0; i<INPUTS_LEN; i++) {
+      if (!procOver[i] || (monoOnly && inputs[i].isPolyphonic()))
+        continue;
+      if (OversampleFilter_4* f = inputUpSample(i, s))
+        f->prime(inputs[i].getPolyVoltageSimd<float_4>(c));
+    }
+    if (monoOnly)
+      return;
+    dcBlockFilter[s][LINFM].prime(inputs[LIN_INPUT].getPolyVoltageSimd<float_4>(c));
+    for (int j=0; j<5; j++) {
+      dcBlockFilter[s][j].reset();
+      outDownSample[s][j].reset();
+      syncBlep[s][j].reset();
+    }
+  }
+
   void setOversample() override {
+    dcBlockCoef = DCBlockFilter_4::coefficient(sampleRate, std::max(oversample, 1));
     for (int i=0; i<4; i++){
       expUpSample[i].setOversample(oversample, oversampleStages);
       linUpSample[i].setOversample(oversample, oversampleStages);
@@ -369,6 +436,37 @@ struct Oscillator : VenomModule {
     }
   }    
   
+  // Checks the 5 outputs of group s and its phase. If any is not finite, the group's state is reset,
+  // including the control rate ramp, and true is returned so the caller clears the outputs.
+  // The control rate hold path runs the same check before its early return.
+  bool groupWatchdog(int s, float_4* out) {
+    if (!(watchdog(out[0]) | watchdog(out[1]) | watchdog(out[2]) | watchdog(out[3]) | watchdog(out[4]) | watchdog(phasor[s])))
+      return false;
+    resetSimdState(s);
+    for (int j=0; j<5; j++)
+      out[j] = lfoOut[s][j] = lfoStep[s][j] = lfoPrev[s][j] = float_4::zero();
+    return true;
+  }
+
+  void resetSimdState(int s) {
+    expUpSample[s].reset();
+    linUpSample[s].reset();
+    revUpSample[s].reset();
+    syncUpSample[s].reset();
+    for (int j=0; j<5; j++){
+      syncBlep[s][j].reset();
+      shapeUpSample[s][j].reset();
+      phaseUpSample[s][j].reset();
+      offsetUpSample[s][j].reset();
+      levelUpSample[s][j].reset();
+      outDownSample[s][j].reset();
+    }
+    for (int j=0; j<6; j++)
+      dcBlockFilter[s][j].reset();
+    phase[s] = simd::int32_4::zero();
+    phasor[s] = float_4::zero();
+  }
+
   void loadPhases(float_4* phases, float_4 phasor, float_4 delta){
     phases[0] = phasor - 2 * delta + ifelse(phasor < 2 * delta, 1.f, ifelse(phasor > (1+2*delta),-1.f,0.f));
     phases[1] = phasor - delta + ifelse(phasor < delta, 1.f, ifelse(phasor > (1+delta),-1.f,0.f));
@@ -395,6 +493,159 @@ struct Oscillator : VenomModule {
     return ((buffer[0] - buffer[1] - buffer[1] + buffer[2])*denInv + 1.f) / 2.f;
   }
 
+  // Optional lookup tables for the log/exp, J-curve and S-curve modes of unmodulated sine,
+  // triangle and saw shapes, indexed by phasor (or saw value) with linear interpolation.
+  // A table is only rebuilt once its shape knob comes to rest, until then the curve is computed.
+  struct ShapeTable {
+    static const int size = 1536;
+    float lo = 0.f, scale = 1.f;
+    int mode = -1;
+    float shape = 0.f, pendingShape = 2.f;
+    float table[size + 4]{};
+
+    float_4 lookup(float_4 u) {
+      float_4 pos = clamp((u - lo) * scale, 0.f, size - 0.01f);
+      simd::int32_4 i = simd::int32_4(pos);
+      float_4 frac = pos - float_4(i), y0, y1;
+      for (int j=0; j<4; j++) {
+        y0[j] = table[i[j]];
+        y1[j] = table[i[j]+1];
+      }
+      return y0 + (y1 - y0) * frac;
+    }
+  };
+  bool shapeLUT = false;
+  ShapeTable shapeTable[4]; // Sin, Tri, unused, Saw
+  dsp::ClockDivider lutDivider;
+
+  // Shape curves for modes 0-4, shared by process() and the shape lookup tables.
+  // sinCurve takes the sine value, triCurve the triangle phasor, and sawCurve the saw value in [0, 1].
+  template <int MODE>
+  static float_4 sinCurve(float_4 x, float_4 shape) {
+    float_4 out;
+    if (MODE == 0) // exp/log
+      return crossfade(x, ifelse(shape>0.f, 11.f*x/(10.f*simd::abs(x)+1.f), simd::sgn(x)*simd::pow(x,4)), ifelse(shape>0.f, shape, -shape))*5.f;
+    if (MODE == 1) // J curve
+      return (normSigmoid((x+1.f)/2.f, -shape*0.9f)*2.f-1.f) * 5.f;
+    if (MODE == 2) // S curve
+      return normSigmoid(x, -shape*0.9f) * 5.f;
+    // 3 Rectify, 4 Normalized Rectify
+    shape = -shape;
+    float_4 shapeSign = simd::sgn(shape);
+    out = simd::ifelse(shapeSign==0, x, -(shapeSign*simd::abs(-x+shapeSign-shape)-shapeSign+shape));
+    if (MODE == 4)
+      out = -((1+simd::abs(shape))*-out-shape);
+    return out * 5.f;
+  }
+
+  // blamp is a corner correction added to the [0, 1] triangle before shaping
+  template <int MODE>
+  static float_4 triCurve(float_4 p, float_4 shape, float_4 blamp = float_4::zero()) {
+    float_4 out;
+    if (MODE <= 2) shape = simd::ifelse(p<500.f, shape, -shape);
+    float_4 x = simd::ifelse(p<500.f, p*.002f, (1000.f-p)*.002f) + blamp;
+    if (MODE == 0) // exp/log
+      return crossfade(x, ifelse(shape>0.f, 11.f*x/(10.f*simd::abs(x)+1.f), simd::sgn(x)*simd::pow(x,4)), ifelse(shape>0.f, shape, -shape))*10.f-5.f;
+    if (MODE == 1) // J curve
+      return normSigmoid(x, -shape*0.8) * 10.f - 5.f;
+    if (MODE == 2) // S curve
+      return normSigmoid(x*2.f-1.f, -shape*0.8) * 5.f;
+    // 3 Rectify, 4 Normalized Rectify
+    shape = -shape;
+    float_4 shapeSign = simd::sgn(shape);
+    out = x*2.f-1.f;
+    out = simd::ifelse(shapeSign==0, out, -(shapeSign*simd::abs(-out+shapeSign-shape)-shapeSign+shape));
+    if (MODE == 4)
+      out = -((1+simd::abs(shape))*-out-shape);
+    return out * 5.f;
+  }
+
+  template <int MODE>
+  static float_4 sawCurve(float_4 x, float_4 shape) {
+    float_4 out;
+    if (MODE == 0) // exp/log
+      return crossfade(x, ifelse(shape>0.f, 11.f*x/(10.f*simd::abs(x)+1.f), simd::sgn(x)*simd::pow(x,4)), ifelse(shape>0.f, shape, -shape))*10.f-5.f;
+    if (MODE == 1) // J Curve
+      return normSigmoid(x, -shape*0.90) * 10.f - 5.f;
+    if (MODE == 2) // S Curve
+      return normSigmoid(x*2.f-1.f, -shape*0.85) * 5.f;
+    // 3 Rectify, 4 Normalized Rectify
+    shape = -shape;
+    float_4 shapeSign = simd::sgn(shape);
+    out = x*2.f-1.f;
+    out = simd::ifelse(shapeSign==0, out, -(shapeSign*simd::abs(-out+shapeSign-shape)-shapeSign+shape));
+    if (MODE == 4)
+      out = -((1+simd::abs(shape))*-out-shape);
+    return out * 5.f;
+  }
+
+  template <int MODE>
+  void fillShapeTable(int wave, float shape) {
+    ShapeTable& t = shapeTable[wave];
+    t.lo = wave==SAW ? -0.25f : 0.f;
+    t.scale = wave==SAW ? 1024.f : ShapeTable::size / 1000.f;
+    for (int i=0; i<=ShapeTable::size; i+=4) {
+      float_4 u = t.lo + float_4(i, i+1, i+2, i+3) / t.scale, y;
+      if (wave==SIN) y = sinCurve<MODE>(sinSimd_1000(u), shape);
+      else if (wave==TRI) y = triCurve<MODE>(u, shape);
+      else y = sawCurve<MODE>(u, shape);
+      y.store(&t.table[i]);
+    }
+    t.mode = MODE;
+    t.shape = shape;
+  }
+
+  // Returns true if the wave's table matches its current unmodulated shape
+  bool updateShapeTable(int wave, int mode, int shapeInput, int shapeParam, bool tick) {
+    if (mode > 2 || inputs[shapeInput].isConnected())
+      return false;
+    ShapeTable& t = shapeTable[wave];
+    float shape = clamp(params[shapeParam].getValue(), -1.f, 1.f);
+    if (t.mode == mode && t.shape == shape)
+      return true;
+    if (!tick)
+      return false;
+    if (shape != t.pendingShape) {
+      t.pendingShape = shape;
+      return false;
+    }
+    switch (mode) {
+      case 0:  fillShapeTable<0>(wave, shape); break;
+      case 1:  fillShapeTable<1>(wave, shape); break;
+      default: fillShapeTable<2>(wave, shape);
+    }
+    return true;
+  }
+
+  // Lanes whose new value missed the predicted ramp by more than half of the last period's movement
+  static float_4 lfoMiss(float_4 val, float_4 out, float_4 step, bool resume) {
+    if (resume)
+      return float_4::zero();
+    return simd::fabs(val - out - step) > simd::fmax(1e-3f, simd::fabs(step) * (0.5f * lfoDivision));
+  }
+
+  // Jumps snapped lanes to val, and ramps the rest toward the value predicted one sample before the next compute
+  static void lfoRamp(float_4 val, float_4& out, float_4& step, float_4& prev, float_4 snap, int elapsed) {
+    float_4 slope = (val - prev) / static_cast<float>(elapsed);
+    float_4 newStep = (val + slope * static_cast<float>(lfoDivision - 1) - out) / static_cast<float>(lfoDivision);
+    step = simd::ifelse(snap, float_4::zero(), newStep);
+    out = simd::ifelse(snap, val, out + newStep);
+    prev = val;
+  }
+
+  // True if a sync or reverse trigger would change state, so the control rate engine
+  // must compute now to keep triggers sample accurate
+  bool lfoTrigChange(int id, dsp::SchmittTrigger* trig) {
+    if (!inputs[id].isConnected())
+      return false;
+    for (int c=0; c<lfoChannels; c++) {
+      float v = inputs[id].getPolyVoltage(c);
+      if (trig[c].isHigh() ? v <= syncLo : v >= syncHi)
+        return true;
+    }
+    return false;
+  }
+
   void process(const ProcessArgs& args) override {
     VenomModule::process(args);
 
@@ -402,8 +653,34 @@ struct Oscillator : VenomModule {
       setMode();
     }
 
-    if (oversample != oversampleValues[params[OVER_PARAM].getValue()]) {
-      oversample = oversampleValues[params[OVER_PARAM].getValue()];
+    if (lfoRate != (lfoControlRate && mode==1)) {
+      lfoRate = !lfoRate;
+      lfoJump = true;
+    }
+    int lfoElapsed = 1;
+    bool lfoSnap = false;
+    if (lfoRate) {
+      lfoSamples++;
+      if (!lfoJump && lfoSamples < lfoNext && !lfoTrigChange(SYNC_INPUT, syncTrig) && !lfoTrigChange(REV_INPUT, revTrig)) {
+        for (int s=0, c=0; c<lfoChannels; s++, c+=4) {
+          for (int j=0; j<5; j++)
+            lfoOut[s][j] += lfoStep[s][j];
+          if (watchdogEnabled)
+            groupWatchdog(s, lfoOut[s]);
+          for (int j=0; j<5; j++)
+            outputs[GRID_OUTPUT+j].setVoltageSimd(lfoOut[s][j], c);
+        }
+        return;
+      }
+      lfoElapsed = lfoJump ? 1 : lfoSamples;
+      // a compute forced early by a trigger jumps to the new value rather than ramping
+      lfoSnap = lfoJump || lfoSamples < lfoNext;
+      lfoSamples = 0;
+    }
+
+    int over = lfoRate ? 1 : oversampleValues[params[OVER_PARAM].getValue()];
+    if (oversample != over) {
+      oversample = over;
       setOversample();
     }
     // get channel count
@@ -420,10 +697,11 @@ struct Oscillator : VenomModule {
     float_4 expIn{}, linIn{}, expDepthIn[4]{}, linDepthIn[4]{}, vOctIn[4]{}, revIn{}, syncIn{}, freq[4]{},
             shapeIn[5]{}, phaseIn[5]{}, offsetIn[5]{}, levelIn[5]{},
             sinOut[4]{}, triOut[4]{}, sqrOut[4]{}, sawOut[4]{}, mixOut[4]{},
-            sinPhasor{}, triPhasor{}, sqrPhasor{}, sawPhasor{}, offsetSawPhasor{}, globalPhasor{},
-            shapeSign{}, phases[3]{};
+            sinPhasor{}, triPhasor{}, sqrPhasor{}, sawPhasor{}, offsetSawPhasor{}, globalOffset{},
+            phases[3]{};
     float vOctParm = mode<2 ? params[FREQ_PARAM].getValue() + params[OCTAVE_PARAM].getValue() : params[FREQ_PARAM].getValue();
-    float k =  1000.f * args.sampleTime / oversample;
+    float k =  1000.f * args.sampleTime * lfoElapsed / oversample;
+    float dcCoef = dcBlockCoef * lfoElapsed;
     float_4 basePhaseDelta{}, lowFreq{}, denInv{};
     
     if (alternate != (mode==2)) {
@@ -456,53 +734,123 @@ struct Oscillator : VenomModule {
     int sawMode = static_cast<int>(params[SAWSHP_PARAM].getValue());
     int mixMode = static_cast<int>(params[MIXSHP_PARAM].getValue());
     int mixType = mixMode % 3;
+    bool sinLUT = false, triLUT = false, sawLUT = false;
+    if (shapeLUT) {
+      bool tick = lutDivider.process();
+      sinLUT = updateShapeTable(SIN, sinMode, SIN_SHAPE_INPUT, SIN_SHAPE_PARAM, tick);
+      triLUT = updateShapeTable(TRI, triMode, TRI_SHAPE_INPUT, TRI_SHAPE_PARAM, tick);
+      sawLUT = updateShapeTable(SAW, sawMode, SAW_SHAPE_INPUT, SAW_SHAPE_PARAM, tick);
+    }
+    // The polyBLAMP triangle corrects the triangle before shaping, so it cannot use the shape table
+    triLUT = triLUT && antiAlias != 2;
     
     bool procSin = outputs[SIN_OUTPUT].isConnected() || (outputs[MIX_OUTPUT].isConnected() && params[SIN_ASIGN_PARAM].getValue() != 1.f);
     bool procTri = outputs[TRI_OUTPUT].isConnected() || (outputs[MIX_OUTPUT].isConnected() && params[TRI_ASIGN_PARAM].getValue() != 1.f);
     bool procSqr = outputs[SQR_OUTPUT].isConnected() || (outputs[MIX_OUTPUT].isConnected() && params[SQR_ASIGN_PARAM].getValue() != 1.f);
     bool procSaw = outputs[SAW_OUTPUT].isConnected() || (outputs[MIX_OUTPUT].isConnected() && params[SAW_ASIGN_PARAM].getValue() != 1.f);
     bool procMix = outputs[MIX_OUTPUT].isConnected();
+    // Waves that only feed the Mix are summed at the oversampled rate before the single Mix
+    // decimator, so their own offset, level, one shot, sync, DC and downsample stages are skipped
+    bool outSin = outputs[SIN_OUTPUT].isConnected();
+    bool outTri = outputs[TRI_OUTPUT].isConnected();
+    bool outSqr = outputs[SQR_OUTPUT].isConnected();
+    bool outSaw = outputs[SAW_OUTPUT].isConnected();
     bool procOver[INPUTS_LEN]{};
     for (int i=0; i<INPUTS_LEN; i++)
       procOver[i] = oversample>1 && inputs[i].isConnected() && !disableOver[i];
+    bool pitchBlock = pitchBlockInterp && oversample>1 && !alternate;
+    if (pitchBlock)
+      procOver[EXP_INPUT] = false;
+    float pitchStep = 1.f / oversample;
+    bool holdOver[INPUTS_LEN]{};
+    for (int i=0; i<INPUTS_LEN; i++) {
+      bool slow = false;
+      if (autoOver && procOver[i])
+        slow = !overDetector[i].process(inputs[i], args.sampleRate);
+      else
+        overDetector[i].reset(); // starts fresh, rather than from stale state, when the input is next monitored
+      // an input that returns to oversampling resumes from its held value rather than stale state
+      if (autoSlow[i] && !slow) {
+        for (int s=0, c=0; s<simdCnt; s++, c+=4) {
+          if (OversampleFilter_4* f = inputUpSample(i, s))
+            f->prime(inputs[i].getPolyVoltageSimd<float_4>(c));
+        }
+      }
+      autoSlow[i] = slow;
+      if (autoSlow[i])
+        procOver[i] = false;
+      holdOver[i] = disableOver[i] || autoSlow[i];
+    }
+    // A one shot group with no sounding voice, settled outputs, and no sync trigger that could start
+    // a voice this sample skips its whole chain and outputs silence. Its sync and reverse triggers
+    // are still tracked, and its filters are primed when it resumes. Monophonic input values are
+    // read by the first group that runs (s0) rather than always by group 0.
+    bool skip[4]{}, resume[4]{};
+    int s0 = 0;
+    bool syncConnected = inputs[SYNC_INPUT].isConnected(), revConnected = inputs[REV_INPUT].isConnected();
+    for (int s=0, c=0; once && s<simdCnt; s++, c+=4) {
+      skip[s] = groupQuiet[s] && !simd::movemask(onceActive[s] != float_4::zero());
+      for (int i=0; skip[s] && syncConnected && i<4; i++)
+        skip[s] = syncTrig[c+i].isHigh() || inputs[SYNC_INPUT].getPolyVoltage(c+i) < syncLo;
+      if (!skip[s])
+        continue;
+      for (int i=0; syncConnected && i<4; i++) {
+        syncPrev[c+i] = inputs[SYNC_INPUT].getPolyVoltage(c+i);
+        syncTrig[c+i].process(syncPrev[c+i], syncLo, syncHi);
+      }
+      for (int i=0; revConnected && i<4; i++)
+        revTrig[c+i].process(inputs[REV_INPUT].getPolyVoltage(c+i), syncLo, syncHi);
+      if (s0 == s)
+        s0++;
+    }
+    for (int s=0, c=0; s<simdCnt; s++, c+=4) {
+      if (!skip[s] && (groupSkip[s] || (s == s0 && s0 != groupFirst))) {
+        resume[s] = groupSkip[s];
+        resumeGroup(s, c, procOver, !groupSkip[s]);
+      }
+      groupSkip[s] = skip[s];
+    }
+    groupFirst = s0;
     // main loops
     for (int o=0; o<oversample; o++){
       for (int s=0, c=0; s<simdCnt; s++, c+=4){
+        if (skip[s])
+          continue;
         float_4 level{}, mixDiv{};
         // Main Phasor
         if (!o) {
           if (!alternate) {
-            if (s==0 || inputs[EXP_DEPTH_INPUT].isPolyphonic()) {
+            if (s==s0 || inputs[EXP_DEPTH_INPUT].isPolyphonic()) {
               expDepthIn[s] = simd::clamp( inputs[EXP_DEPTH_INPUT].getNormalPolyVoltageSimd<float_4>(5.f,c)/5.f, -1.f, 1.f);
-            } else expDepthIn[s] = expDepthIn[0];
+            } else expDepthIn[s] = expDepthIn[s0];
           }
-          if (s==0 || inputs[LIN_DEPTH_INPUT].isPolyphonic()) {
+          if (s==s0 || inputs[LIN_DEPTH_INPUT].isPolyphonic()) {
             linDepthIn[s] = simd::clamp( inputs[LIN_DEPTH_INPUT].getNormalPolyVoltageSimd<float_4>(5.f,c)/5.f, -1.f, 1.f);
-          } else linDepthIn[s] = linDepthIn[0];
-          if (s==0 || inputs[VOCT_INPUT].isPolyphonic()) {
+          } else linDepthIn[s] = linDepthIn[s0];
+          if (s==s0 || inputs[VOCT_INPUT].isPolyphonic()) {
             vOctIn[s] = inputs[VOCT_INPUT].getPolyVoltageSimd<float_4>(c);
-          } else vOctIn[s] = vOctIn[0];
+          } else vOctIn[s] = vOctIn[s0];
         }
         if (!alternate) {
-          if (s==0 || inputs[EXP_INPUT].isPolyphonic()) {
-            expIn = (o && !disableOver[EXP_INPUT]) ? float_4::zero() : inputs[EXP_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[EXP_INPUT].isPolyphonic()) {
+            expIn = (o && !holdOver[EXP_INPUT]) ? float_4::zero() : inputs[EXP_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[EXP_INPUT]){
               if (o==0) expIn *= oversample;
               expIn = expUpSample[s].process(expIn);
             }
           } // else preserve prior expIn value
         }
-        if (s==0 || inputs[LIN_INPUT].isPolyphonic()) {
-          linIn = (o && !disableOver[LIN_INPUT]) ? float_4::zero() : inputs[LIN_INPUT].getPolyVoltageSimd<float_4>(c);
+        if (s==s0 || inputs[LIN_INPUT].isPolyphonic()) {
+          linIn = (o && !holdOver[LIN_INPUT]) ? float_4::zero() : inputs[LIN_INPUT].getPolyVoltageSimd<float_4>(c);
           if (procOver[LIN_INPUT]){
             if (o==0) linIn *= oversample;
             linIn = linUpSample[s].process(linIn);
           }
         } // else preserve prior linIn value
         if (inputs[LIN_INPUT].isConnected() && !linDCCouple)
-          linIn = dcBlockFilter[s][LINFM].process(linIn/*, oversample*/);
-        if (s==0 || inputs[MIX_PHASE_INPUT].isPolyphonic()) {
-          phaseIn[MIX] = (o && !disableOver[MIX_PHASE_INPUT]) ? float_4::zero() : inputs[MIX_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
+          linIn = dcBlockFilter[s][LINFM].process(linIn, dcCoef);
+        if (s==s0 || inputs[MIX_PHASE_INPUT].isPolyphonic()) {
+          phaseIn[MIX] = (o && !holdOver[MIX_PHASE_INPUT]) ? float_4::zero() : inputs[MIX_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
           if (procOver[MIX_PHASE_INPUT]){
             if (o==0) phaseIn[MIX] *= oversample;
             phaseIn[MIX] = phaseUpSample[s][MIX].process(phaseIn[MIX]);
@@ -510,8 +858,8 @@ struct Oscillator : VenomModule {
         } // else preserve prior phaseIn[MIX] value
         float_4 rev{};
         if (inputs[REV_INPUT].isConnected()) {
-          if (s==0 || inputs[REV_INPUT].isPolyphonic()) {
-            revIn = (o && !disableOver[REV_INPUT]) ? float_4::zero() : inputs[REV_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[REV_INPUT].isPolyphonic()) {
+            revIn = (o && !holdOver[REV_INPUT]) ? float_4::zero() : inputs[REV_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[REV_INPUT]){
               if (o==0) revIn *= oversample;
               revIn = revUpSample[s].process(revIn);
@@ -521,10 +869,35 @@ struct Oscillator : VenomModule {
             rev[i] = revTrig[c+i].process(revIn[i], syncLo, syncHi);
           }
         }
-        float_4 sync{};
-        if (inputs[SYNC_INPUT].isConnected()) {
-          if (s==0 || inputs[SYNC_INPUT].isPolyphonic()) {
-            syncIn = (o && !disableOver[SYNC_INPUT]) ? float_4::zero() : inputs[SYNC_INPUT].getPolyVoltageSimd<float_4>(c);
+        float_4 sync{}, syncP{};
+        if (inputs[SYNC_INPUT].isConnected() && subSampleSync) {
+          if (!o) {
+            if (s==s0 || inputs[SYNC_INPUT].isPolyphonic()) {
+              syncIn = inputs[SYNC_INPUT].getPolyVoltageSimd<float_4>(c);
+            } // else preserve prior syncIn value
+            for (int i=0; i<4; i++){
+              if (syncTrig[c+i].process(syncIn[i], syncLo, syncHi) && !(noRetrigger && onceActive[s][i])) {
+                // Linear interpolation of the threshold crossing between the prior and current sample
+                float delta = syncIn[i] - syncPrev[c+i];
+                float t = delta > 0.f ? clamp((syncHi - syncPrev[c+i]) / delta, 0.f, 1.f) : 1.f;
+                int step = std::min(static_cast<int>(t * oversample), oversample - 1);
+                syncStep[c+i] = step + 1;
+                syncFrac[c+i] = step + 1 - t * oversample;
+              }
+              syncPrev[c+i] = syncIn[i];
+            }
+          }
+          for (int i=0; i<4; i++){
+            if (syncStep[c+i] == o+1) {
+              sync[i] = 1.f;
+              syncP[i] = syncFrac[c+i];
+              syncStep[c+i] = 0;
+            }
+          }
+        }
+        else if (inputs[SYNC_INPUT].isConnected()) {
+          if (s==s0 || inputs[SYNC_INPUT].isPolyphonic()) {
+            syncIn = (o && !holdOver[SYNC_INPUT]) ? float_4::zero() : inputs[SYNC_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SYNC_INPUT]){
               if (o==0) syncIn *= oversample;
               syncIn = syncUpSample[s].process(syncIn);
@@ -534,7 +907,14 @@ struct Oscillator : VenomModule {
             sync[i] = syncTrig[c+i].process(syncIn[i], syncLo, syncHi) && !(noRetrigger && onceActive[s][i]);
           }
         } else onceActive[s] = float_4::zero();
-        if (!alternate) {
+        if (pitchBlock) {
+          if (!o) {
+            float_4 pitch = dsp::exp2_taylor5(vOctIn[s] + vOctParm + expIn*expDepthIn[s]*params[EXP_PARAM].getValue());
+            pitchPrev[s] = (pitchBlockReset || resume[s]) ? pitch : pitchNext[s];
+            pitchNext[s] = pitch;
+          }
+          freq[s] = pitchPrev[s] + (pitchNext[s] - pitchPrev[s]) * ((o+1) * pitchStep) + linIn*linDepthIn[s]*params[LIN_PARAM].getValue();
+        } else if (!alternate) {
           freq[s] = vOctIn[s] + vOctParm + expIn*expDepthIn[s]*params[EXP_PARAM].getValue();
           freq[s] = dsp::exp2_taylor5(freq[s]) + linIn*linDepthIn[s]*params[LIN_PARAM].getValue();
         } else {
@@ -544,19 +924,23 @@ struct Oscillator : VenomModule {
         phasorDir[s] = simd::ifelse(rev>0.f, phasorDir[s]*-1.f, phasorDir[s]);
         phasorDir[s] = simd::ifelse(sync>0.f, 1.f, phasorDir[s]);
         basePhaseDelta = freq[s] * phasorDir[s] * k;
-        phasor[s] += basePhaseDelta;
-        if (aliasSuppress) {
+        if (once) {
+          float_4 tempPhasor = phasor[s] + basePhaseDelta;
+          onceActive[s] = simd::ifelse((tempPhasor<0.f) | (tempPhasor>=1000.f), float_4::zero(), onceActive[s]);
+        }
+        phase[s] += phasorToPhase32(basePhaseDelta);
+        if (antiAlias) {
           basePhaseDelta *= 0.001f;
-          lowFreq = simd::abs(basePhaseDelta) < 1e-3;
-          denInv = 1.f/basePhaseDelta;
-          denInv = denInv * denInv * 0.25;
+          if (antiAlias == 1) {
+            lowFreq = simd::abs(basePhaseDelta) < 1e-3;
+            denInv = 1.f/basePhaseDelta;
+            denInv = denInv * denInv * 0.25;
+          }
         }
-        float_4 tempPhasor = simd::fmod(phasor[s], 1000.f);
-        tempPhasor = simd::ifelse(tempPhasor<0.f, tempPhasor+1000.f, tempPhasor);
-        if (once)
-          onceActive[s] = simd::ifelse(tempPhasor != phasor[s], float_4::zero(), onceActive[s]);
-        phasor[s] = tempPhasor;
-        phasor[s] = simd::ifelse(sync>0.f, float_4::zero(), phasor[s]);
+        // Reset to 0, or to the phase advanced since the sub-sample sync crossing
+        simd::int32_4 syncPhase = subSampleSync ? phasorToPhase32(freq[s] * k * syncP) : simd::int32_4::zero();
+        phase[s] += (syncPhase - phase[s]) & simd::int32_4::cast(sync>0.f);
+        phasor[s] = phase32ToPhasor(phase[s]);
         if (once)
           onceActive[s] = simd::ifelse(sync>float_4::zero(), 1.f, onceActive[s]);
         if (gated){
@@ -567,65 +951,52 @@ struct Oscillator : VenomModule {
         }
 
         // Global (Mix) Phase
-        globalPhasor = phasor[s] + (phaseIn[MIX]*params[MIX_PHASE_AMT_PARAM].getValue() + params[MIX_PHASE_PARAM].getValue()*2.f)*250.f;
+        globalOffset = (phaseIn[MIX]*params[MIX_PHASE_AMT_PARAM].getValue() + params[MIX_PHASE_PARAM].getValue()*2.f)*250.f;
 
         mixOut[s] = float_4::zero();
 
         // Sine
         if (procSin)
         {
-          if (s==0 || inputs[SIN_SHAPE_INPUT].isPolyphonic()) {
-            shapeIn[SIN] = (o && !disableOver[SIN_SHAPE_INPUT]) ? float_4::zero() : inputs[SIN_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SIN_SHAPE_INPUT].isPolyphonic()) {
+            shapeIn[SIN] = (o && !holdOver[SIN_SHAPE_INPUT]) ? float_4::zero() : inputs[SIN_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SIN_SHAPE_INPUT]){
               if (o==0) shapeIn[SIN] *= oversample;
               shapeIn[SIN] = shapeUpSample[s][SIN].process(shapeIn[SIN]);
             }
           } // preserve prior shapeIn[SIN] value
           float_4 shape = clamp(shapeIn[SIN]*params[SIN_SHAPE_AMT_PARAM].getValue()*shpScale[SIN] + params[SIN_SHAPE_PARAM].getValue(), -1.f, 1.f);
-          if (s==0 || inputs[SIN_PHASE_INPUT].isPolyphonic()) {
-            phaseIn[SIN] = (o && !disableOver[SIN_PHASE_INPUT]) ? float_4::zero() : inputs[SIN_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SIN_PHASE_INPUT].isPolyphonic()) {
+            phaseIn[SIN] = (o && !holdOver[SIN_PHASE_INPUT]) ? float_4::zero() : inputs[SIN_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SIN_PHASE_INPUT]){
               if (o==0) phaseIn[SIN] *= oversample;
               phaseIn[SIN] = phaseUpSample[s][SIN].process(phaseIn[SIN]);
             }
           } // else preserve prior phaseIn[SIN] value
-          sinPhasor = globalPhasor + (phaseIn[SIN]*params[SIN_PHASE_AMT_PARAM].getValue() + params[SIN_PHASE_PARAM].getValue()*2.f)*250.f - 250.f;
-          sinPhasor = simd::fmod(sinPhasor, 1000.f);
-          sinPhasor = simd::ifelse(sinPhasor<0.f, sinPhasor+1000.f, sinPhasor);
-          sinPhasor = sinSimd_1000(sinPhasor);
-          switch (sinMode) {
-            case 0:  // exp/log
-              sinOut[s] = crossfade(sinPhasor, ifelse(shape>0.f, 11.f*sinPhasor/(10.f*simd::abs(sinPhasor)+1.f), simd::sgn(sinPhasor)*simd::pow(sinPhasor,4)), ifelse(shape>0.f, shape, -shape))*5.f;
-              break;
-            case 1:  // J curve
-              sinOut[s] = (normSigmoid((sinPhasor+1.f)/2.f, -shape*0.9f)*2.f-1.f) * 5.f;
-              break;
-            case 2: // S curve
-              sinOut[s] = normSigmoid(sinPhasor, -shape*0.9f) * 5.f;
-              break;
-            case 3: // Rectify
-            case 4: // Normalized Rectify
-              shape = -shape;
-              shapeSign = simd::sgn(shape);
-              sinOut[s] = simd::ifelse(shapeSign==0, sinPhasor, -(shapeSign*simd::abs(-sinPhasor+shapeSign-shape)-shapeSign+shape));
-              if (sinMode==4 /*Normalized Rectify*/)
-                sinOut[s] = -((1+simd::abs(shape))*-sinOut[s]-shape);
-              sinOut[s] *= 5.f;
-              break;
-            default: // 5 morph square <--> sine <--> saw
-              sinOut[s] = sinPhasor * 5.f * (1.f - simd::abs(shape)); // sine component
-              // square and saw components
-              sinPhasor = globalPhasor + (phaseIn[SIN]*params[SIN_PHASE_AMT_PARAM].getValue() + params[SIN_PHASE_PARAM].getValue()*2.f)*250.f;
-              sinPhasor = simd::fmod(sinPhasor + simd::ifelse(sinPhasor<0.f, 0.f, 500.f), 1000.f);
-              sinPhasor = simd::ifelse(sinPhasor<0.f, sinPhasor+1000.f, sinPhasor);
-              sinOut[s] += simd::ifelse( shape<=0.f,
-                                         simd::ifelse(sinPhasor<500.f, 5.f, -5.f) * shape, // square component
-                                         (sinPhasor*0.01f - 5.f) * shape // saw component
-                                       );
+          float_4 offset = globalOffset + (phaseIn[SIN]*params[SIN_PHASE_AMT_PARAM].getValue() + params[SIN_PHASE_PARAM].getValue()*2.f)*250.f;
+          sinPhasor = phase32Phasor(phase[s], offset - 250.f);
+          if (sinLUT) {
+            sinOut[s] = shapeTable[SIN].lookup(sinPhasor);
+          } else {
+            switch (sinMode) {
+              case 0:  sinOut[s] = sinCurve<0>(sinSimd_1000(sinPhasor), shape); break; // exp/log
+              case 1:  sinOut[s] = sinCurve<1>(sinSimd_1000(sinPhasor), shape); break; // J curve
+              case 2:  sinOut[s] = sinCurve<2>(sinSimd_1000(sinPhasor), shape); break; // S curve
+              case 3:  sinOut[s] = sinCurve<3>(sinSimd_1000(sinPhasor), shape); break; // Rectify
+              case 4:  sinOut[s] = sinCurve<4>(sinSimd_1000(sinPhasor), shape); break; // Normalized Rectify
+              default: // 5 morph square <--> sine <--> saw
+                sinOut[s] = sinSimd_1000(sinPhasor) * 5.f * (1.f - simd::abs(shape)); // sine component
+                // square and saw components
+                sinPhasor = phase32Phasor(phase[s], offset + simd::ifelse(phasor[s] + offset < 0.f, 0.f, 500.f));
+                sinOut[s] += simd::ifelse( shape<=0.f,
+                                           simd::ifelse(sinPhasor<500.f, 5.f, -5.f) * shape, // square component
+                                           (sinPhasor*0.01f - 5.f) * shape // saw component
+                                         );
+            }
           }
 
-          if (s==0 || inputs[SIN_LEVEL_INPUT].isPolyphonic()) {
-            levelIn[SIN] = (o && !disableOver[SIN_LEVEL_INPUT]) ? float_4::zero() : inputs[SIN_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SIN_LEVEL_INPUT].isPolyphonic()) {
+            levelIn[SIN] = (o && !holdOver[SIN_LEVEL_INPUT]) ? float_4::zero() : inputs[SIN_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SIN_LEVEL_INPUT]){
               if (o==0) levelIn[SIN] *= oversample;
               levelIn[SIN] = levelUpSample[s][SIN].process(levelIn[SIN]);
@@ -640,75 +1011,69 @@ struct Oscillator : VenomModule {
             mixDiv += simd::fabs(level);
           }
 
-          if (s==0 || inputs[SIN_OFFSET_INPUT].isPolyphonic()) {
-            offsetIn[SIN] = (o && !disableOver[SIN_OFFSET_INPUT]) ? float_4::zero() : inputs[SIN_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
-            if (procOver[SIN_OFFSET_INPUT]){
-              if (o==0) offsetIn[SIN] *= oversample;
-              offsetIn[SIN] = offsetUpSample[s][SIN].process(offsetIn[SIN]);
-            }
-          } // else preserve prior offsetIn[SIN] value
-          sinOut[s] += clamp(offsetIn[SIN]*params[SIN_OFFSET_AMT_PARAM].getValue() + params[SIN_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
-          if (params[SIN_ASIGN_PARAM].getValue()!=0)
-            sinOut[s] *= level;  
+          if (outSin) {
+            if (s==s0 || inputs[SIN_OFFSET_INPUT].isPolyphonic()) {
+              offsetIn[SIN] = (o && !holdOver[SIN_OFFSET_INPUT]) ? float_4::zero() : inputs[SIN_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
+              if (procOver[SIN_OFFSET_INPUT]){
+                if (o==0) offsetIn[SIN] *= oversample;
+                offsetIn[SIN] = offsetUpSample[s][SIN].process(offsetIn[SIN]);
+              }
+            } // else preserve prior offsetIn[SIN] value
+            sinOut[s] += clamp(offsetIn[SIN]*params[SIN_OFFSET_AMT_PARAM].getValue() + params[SIN_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
+            if (params[SIN_ASIGN_PARAM].getValue()!=0)
+              sinOut[s] *= level;  
+          }
         }
         
         // Triangle
         if (procTri)
         {
-          if (s==0 || inputs[TRI_SHAPE_INPUT].isPolyphonic()) {
-            shapeIn[TRI] = (o && !disableOver[TRI_SHAPE_INPUT]) ? float_4::zero() : inputs[TRI_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[TRI_SHAPE_INPUT].isPolyphonic()) {
+            shapeIn[TRI] = (o && !holdOver[TRI_SHAPE_INPUT]) ? float_4::zero() : inputs[TRI_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[TRI_SHAPE_INPUT]){
               if (o==0) shapeIn[TRI] *= oversample;
               shapeIn[TRI] = shapeUpSample[s][TRI].process(shapeIn[TRI]);
             }
           } // else preserve prior shapeIn[TRI] value
           float_4 shape = clamp(shapeIn[TRI]*params[TRI_SHAPE_AMT_PARAM].getValue()*shpScale[TRI] + params[TRI_SHAPE_PARAM].getValue(), -1.f, 1.f);
-          if (s==0 || inputs[TRI_PHASE_INPUT].isPolyphonic()) {
-            phaseIn[TRI] = (o && !disableOver[TRI_PHASE_INPUT]) ? float_4::zero() : inputs[TRI_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[TRI_PHASE_INPUT].isPolyphonic()) {
+            phaseIn[TRI] = (o && !holdOver[TRI_PHASE_INPUT]) ? float_4::zero() : inputs[TRI_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[TRI_PHASE_INPUT]){
               if (o==0) phaseIn[TRI] *= oversample;
               phaseIn[TRI] = phaseUpSample[s][TRI].process(phaseIn[TRI]);
             }
           } // else preserve prior phaseIn[TRI] value
-          triPhasor = globalPhasor + (phaseIn[TRI]*params[TRI_PHASE_AMT_PARAM].getValue() + params[TRI_PHASE_PARAM].getValue()*2.f)*250.f + 250.f;
-          triPhasor = simd::fmod(triPhasor, 1000.f);
-          triPhasor = simd::ifelse(triPhasor<0.f, triPhasor+1000.f, triPhasor);
-          if (triMode<=2) shape = simd::ifelse(triPhasor<500.f, shape, -shape);
-          triPhasor = simd::ifelse(triPhasor<500.f, triPhasor*.002f, (1000.f-triPhasor)*.002f);
-          switch (triMode) {
-            case 0:  // exp/log
-              triOut[s] = crossfade(triPhasor, ifelse(shape>0.f, 11.f*triPhasor/(10.f*simd::abs(triPhasor)+1.f), simd::sgn(triPhasor)*simd::pow(triPhasor,4)), ifelse(shape>0.f, shape, -shape))*10.f-5.f;
-              break;
-            case 1:  // J curve
-              triOut[s] = normSigmoid(triPhasor, -shape*0.8) * 10.f - 5.f;
-              break;
-            case 2: // S curve
-              triOut[s] = normSigmoid(triPhasor*2.f-1.f, -shape*0.8) * 5.f;
-              break;
-            case 3: // Rectify
-            case 4: // Normalized Rectify
-              shape = -shape;
-              shapeSign = simd::sgn(shape);
-              triOut[s] = triPhasor*2.f-1.f;
-              triOut[s] = simd::ifelse(shapeSign==0, triOut[s], -(shapeSign*simd::abs(-triOut[s]+shapeSign-shape)-shapeSign+shape));
-              if (triMode==4 /*Normalized Rectify*/)
-                triOut[s] = -((1+simd::abs(shape))*-triOut[s]-shape);
-              triOut[s] *= 5.f;
-              break;
-            default: // 5 morph sine <--> triangle <--> square
-              triOut[s] = (triPhasor*10.f - 5.f) * (1.f - simd::abs(shape)); // triangle component
-              // sine and square components
-              triPhasor = globalPhasor + (phaseIn[TRI]*params[TRI_PHASE_AMT_PARAM].getValue() + params[TRI_PHASE_PARAM].getValue()*2.f)*250.f;
-              triPhasor = simd::fmod(triPhasor - simd::ifelse(shape<=0.f, 250.f, 0.f), 1000.f);
-              triPhasor = simd::ifelse(triPhasor<0.f, triPhasor+1000.f, triPhasor);
-              triOut[s] += simd::ifelse( shape<=0.f,
-                                         sinSimd_1000(triPhasor)*5.f * -shape, // sine component
-                                         simd::ifelse(triPhasor<500.f, 5.f, -5.f) * shape // square component
-                                       );
-              }
+          float_4 offset = globalOffset + (phaseIn[TRI]*params[TRI_PHASE_AMT_PARAM].getValue() + params[TRI_PHASE_PARAM].getValue()*2.f)*250.f;
+          triPhasor = phase32Phasor(phase[s], offset + 250.f);
+          float_4 blamp{};
+          if (antiAlias == 2 && triMode < 3) {
+            // the slope changes by +4 at the trough and -4 at the peak
+            float_4 t = triPhasor * 0.001f, dt = simd::fmax(simd::fabs(basePhaseDelta), 1e-6f);
+            float_4 u = t + simd::ifelse(t < 0.5f, 0.5f, -0.5f);
+            blamp = (polyBlamp(t, dt) - polyBlamp(u, dt)) * 4.f;
+          }
+          if (triLUT) {
+            triOut[s] = shapeTable[TRI].lookup(triPhasor);
+          } else {
+            switch (triMode) {
+              case 0:  triOut[s] = triCurve<0>(triPhasor, shape, blamp); break; // exp/log
+              case 1:  triOut[s] = triCurve<1>(triPhasor, shape, blamp); break; // J curve
+              case 2:  triOut[s] = triCurve<2>(triPhasor, shape, blamp); break; // S curve
+              case 3:  triOut[s] = triCurve<3>(triPhasor, shape); break; // Rectify
+              case 4:  triOut[s] = triCurve<4>(triPhasor, shape); break; // Normalized Rectify
+              default: // 5 morph sine <--> triangle <--> square
+                triOut[s] = (simd::ifelse(triPhasor<500.f, triPhasor*.002f, (1000.f-triPhasor)*.002f)*10.f - 5.f) * (1.f - simd::abs(shape)); // triangle component
+                // sine and square components
+                triPhasor = phase32Phasor(phase[s], offset - simd::ifelse(shape<=0.f, 250.f, 0.f));
+                triOut[s] += simd::ifelse( shape<=0.f,
+                                           sinSimd_1000(triPhasor)*5.f * -shape, // sine component
+                                           simd::ifelse(triPhasor<500.f, 5.f, -5.f) * shape // square component
+                                         );
+            }
+          }
 
-          if (s==0 || inputs[TRI_LEVEL_INPUT].isPolyphonic()) {
-            levelIn[TRI] = (o && !disableOver[TRI_LEVEL_INPUT]) ? float_4::zero() : inputs[TRI_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[TRI_LEVEL_INPUT].isPolyphonic()) {
+            levelIn[TRI] = (o && !holdOver[TRI_LEVEL_INPUT]) ? float_4::zero() : inputs[TRI_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[TRI_LEVEL_INPUT]){
               if (o==0) levelIn[TRI] *= oversample;
               levelIn[TRI] = levelUpSample[s][TRI].process(levelIn[TRI]);
@@ -723,46 +1088,45 @@ struct Oscillator : VenomModule {
             mixDiv += simd::fabs(level);
           }
 
-          if (s==0 || inputs[TRI_OFFSET_INPUT].isPolyphonic()) {
-            offsetIn[TRI] = (o && !disableOver[TRI_OFFSET_INPUT]) ? float_4::zero() : inputs[TRI_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
-            if (procOver[TRI_OFFSET_INPUT]){
-              if (o==0) offsetIn[TRI] *= oversample;
-              offsetIn[TRI] = offsetUpSample[s][TRI].process(offsetIn[TRI]);
-            }
-          } // else preserve prior offsetIn[TRI] value
-          triOut[s] += clamp(offsetIn[TRI]*params[TRI_OFFSET_AMT_PARAM].getValue() + params[TRI_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
-          if (params[TRI_ASIGN_PARAM].getValue()!=0)
-            triOut[s] *= level;  
+          if (outTri) {
+            if (s==s0 || inputs[TRI_OFFSET_INPUT].isPolyphonic()) {
+              offsetIn[TRI] = (o && !holdOver[TRI_OFFSET_INPUT]) ? float_4::zero() : inputs[TRI_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
+              if (procOver[TRI_OFFSET_INPUT]){
+                if (o==0) offsetIn[TRI] *= oversample;
+                offsetIn[TRI] = offsetUpSample[s][TRI].process(offsetIn[TRI]);
+              }
+            } // else preserve prior offsetIn[TRI] value
+            triOut[s] += clamp(offsetIn[TRI]*params[TRI_OFFSET_AMT_PARAM].getValue() + params[TRI_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
+            if (params[TRI_ASIGN_PARAM].getValue()!=0)
+              triOut[s] *= level;  
+          }
         }
         
         // Square
         if (procSqr)
         {
-          if (s==0 || inputs[SQR_SHAPE_INPUT].isPolyphonic()) {
-            shapeIn[SQR] = (o && !disableOver[SQR_SHAPE_INPUT]) ? float_4::zero() : inputs[SQR_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SQR_SHAPE_INPUT].isPolyphonic()) {
+            shapeIn[SQR] = (o && !holdOver[SQR_SHAPE_INPUT]) ? float_4::zero() : inputs[SQR_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SQR_SHAPE_INPUT]){
               if (o==0) shapeIn[SQR] *= oversample;
               shapeIn[SQR] = shapeUpSample[s][SQR].process(shapeIn[SQR]);
             }
           } // else preserve prior shapeIn[SQR] value
-          if (s==0 || inputs[SQR_PHASE_INPUT].isPolyphonic()) {
-            phaseIn[SQR] = (o && !disableOver[SQR_PHASE_INPUT]) ? float_4::zero() : inputs[SQR_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SQR_PHASE_INPUT].isPolyphonic()) {
+            phaseIn[SQR] = (o && !holdOver[SQR_PHASE_INPUT]) ? float_4::zero() : inputs[SQR_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SQR_PHASE_INPUT]){
               if (o==0) phaseIn[SQR] *= oversample;
               phaseIn[SQR] = phaseUpSample[s][SQR].process(phaseIn[SQR]);
             }
           } // else preserve prior phaseIn[SQR] value
-          sqrPhasor = globalPhasor + (phaseIn[SQR]*params[SQR_PHASE_AMT_PARAM].getValue() + params[SQR_PHASE_PARAM].getValue()*2.f)*250.f;
-          sqrPhasor = simd::fmod(sqrPhasor, 1000.f);
-          sqrPhasor = simd::ifelse(sqrPhasor<0.f, sqrPhasor+1000.f, sqrPhasor);
+          float_4 offset = globalOffset + (phaseIn[SQR]*params[SQR_PHASE_AMT_PARAM].getValue() + params[SQR_PHASE_PARAM].getValue()*2.f)*250.f;
+          sqrPhasor = phase32Phasor(phase[s], offset);
           if (sqrMode==2) { // morph tri <--> sqr <--> saw
             float_4 shape = clamp(shapeIn[SQR]*params[SQR_SHAPE_AMT_PARAM].getValue()*shpScale[SQR] + params[SQR_SHAPE_PARAM].getValue(), -1.f, 1.f);
             sqrOut[s] = simd::ifelse(sqrPhasor<500.f, 5.f, -5.f) * (1.f - simd::abs(shape)); // square component
             // triangle and saw components
-            sqrPhasor = globalPhasor + (phaseIn[SQR]*params[SQR_PHASE_AMT_PARAM].getValue() + params[SQR_PHASE_PARAM].getValue()*2.f)*250.f;
-            sqrPhasor = simd::fmod(sqrPhasor + simd::ifelse(shape<=0.f, 250.f, 500.f), 1000.f);
-            sqrPhasor = simd::ifelse(sqrPhasor<0.f, sqrPhasor+1000.f, sqrPhasor);
-            sqrOut[s] += simd::ifelse( shape<=0.f, 
+            sqrPhasor = phase32Phasor(phase[s], offset + simd::ifelse(shape<=0.f, 250.f, 500.f));
+            sqrOut[s] += simd::ifelse( shape<=0.f,
                                        (simd::ifelse(sqrPhasor<500.f, sqrPhasor, (1000.f-sqrPhasor))*.02f - 5.f) * -shape, // triangle component
                                        (sqrPhasor*0.01f - 5.f) * shape // saw component
                                      );
@@ -770,15 +1134,21 @@ struct Oscillator : VenomModule {
             float_4 flip = (shapeIn[SQR]*params[SQR_SHAPE_AMT_PARAM].getValue()*shpScale[SQR] + params[SQR_SHAPE_PARAM].getValue() + 1.f) * 500.f;
             if (!sqrMode) flip = clamp( flip, 30.f, 970.f );
             sqrOut[s] = simd::ifelse(sqrPhasor<flip, 5.f, -5.f);
-            if (aliasSuppress) {
+            if (antiAlias == 1) {
               loadPhases(phases, sqrPhasor * 0.001f, basePhaseDelta);
               sawPhasor = aliasSuppressedSaw(phases, denInv);
               offsetSawPhasor = aliasSuppressedOffsetSaw(phases, 1.f - flip*0.001f, denInv);
               sqrOut[s] = ifelse(lowFreq, sqrOut[s], (offsetSawPhasor - sawPhasor + flip*0.001f - 0.5f) * 10.f);
             }
+            if (antiAlias == 2) { // rising step at phase 0, falling step at the pulse width
+              float_4 t = sqrPhasor * 0.001f, dt = simd::fmax(simd::fabs(basePhaseDelta), 1e-6f);
+              float_4 u = t - clamp(flip * 0.001f, 0.f, 1.f);
+              u += simd::ifelse(u < 0.f, 1.f, 0.f);
+              sqrOut[s] += (polyBlep(t, dt) - polyBlep(u, dt)) * 10.f;
+            }
           }
-          if (s==0 || inputs[SQR_LEVEL_INPUT].isPolyphonic()) {
-            levelIn[SQR] = (o && !disableOver[SQR_LEVEL_INPUT]) ? float_4::zero() : inputs[SQR_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SQR_LEVEL_INPUT].isPolyphonic()) {
+            levelIn[SQR] = (o && !holdOver[SQR_LEVEL_INPUT]) ? float_4::zero() : inputs[SQR_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SQR_LEVEL_INPUT]){
               if (o==0) levelIn[SQR] *= oversample;
               levelIn[SQR] = levelUpSample[s][SQR].process(levelIn[SQR]);
@@ -793,80 +1163,68 @@ struct Oscillator : VenomModule {
             mixDiv += simd::fabs(level);
           }
 
-          if (s==0 || inputs[SQR_OFFSET_INPUT].isPolyphonic()) {
-            offsetIn[SQR] = (o && !disableOver[SQR_OFFSET_INPUT]) ? float_4::zero() : inputs[SQR_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
-            if (procOver[SQR_OFFSET_INPUT]){
-              if (o==0) offsetIn[SQR] *= oversample;
-              offsetIn[SQR] = offsetUpSample[s][SQR].process(offsetIn[SQR]);
-            }
-          } // else preserve prior offsetIn[SQR] value
-          sqrOut[s] += clamp(offsetIn[SQR]*params[SQR_OFFSET_AMT_PARAM].getValue() + params[SQR_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
-          if (params[SQR_ASIGN_PARAM].getValue()!=0)
-            sqrOut[s] *= level;  
+          if (outSqr) {
+            if (s==s0 || inputs[SQR_OFFSET_INPUT].isPolyphonic()) {
+              offsetIn[SQR] = (o && !holdOver[SQR_OFFSET_INPUT]) ? float_4::zero() : inputs[SQR_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
+              if (procOver[SQR_OFFSET_INPUT]){
+                if (o==0) offsetIn[SQR] *= oversample;
+                offsetIn[SQR] = offsetUpSample[s][SQR].process(offsetIn[SQR]);
+              }
+            } // else preserve prior offsetIn[SQR] value
+            sqrOut[s] += clamp(offsetIn[SQR]*params[SQR_OFFSET_AMT_PARAM].getValue() + params[SQR_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
+            if (params[SQR_ASIGN_PARAM].getValue()!=0)
+              sqrOut[s] *= level;  
+          }
         }
         
         // Saw
         if (procSaw)
         {
-          if (s==0 || inputs[SAW_SHAPE_INPUT].isPolyphonic()) {
-            shapeIn[SAW] = (o && !disableOver[SAW_SHAPE_INPUT]) ? float_4::zero() : inputs[SAW_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SAW_SHAPE_INPUT].isPolyphonic()) {
+            shapeIn[SAW] = (o && !holdOver[SAW_SHAPE_INPUT]) ? float_4::zero() : inputs[SAW_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SAW_SHAPE_INPUT]){
               if (o==0) shapeIn[SAW] *= oversample;
               shapeIn[SAW] = shapeUpSample[s][SAW].process(shapeIn[SAW]);
             }
           } // else preserve prior shapeIn[SAW] value
           float_4 shape = clamp(shapeIn[SAW]*params[SAW_SHAPE_AMT_PARAM].getValue()*shpScale[SAW] + params[SAW_SHAPE_PARAM].getValue(), -1.f, 1.f);
-          if (s==0 || inputs[SAW_PHASE_INPUT].isPolyphonic()) {
-            phaseIn[SAW] = (o && !disableOver[SAW_PHASE_INPUT]) ? float_4::zero() : inputs[SAW_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SAW_PHASE_INPUT].isPolyphonic()) {
+            phaseIn[SAW] = (o && !holdOver[SAW_PHASE_INPUT]) ? float_4::zero() : inputs[SAW_PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SAW_PHASE_INPUT]){
               if (o==0) phaseIn[SAW] *= oversample;
               phaseIn[SAW] = phaseUpSample[s][SAW].process(phaseIn[SAW]);
             }
           } // else preserve prior phaseIn[SAW] value
-          sawPhasor = globalPhasor + (phaseIn[SAW]*params[SAW_PHASE_AMT_PARAM].getValue() + params[SAW_PHASE_PARAM].getValue()*2.f)*250.f;
-          sawPhasor = simd::fmod(sawPhasor, 1000.f);
-          sawPhasor = simd::ifelse(sawPhasor<0.f, sawPhasor+1000.f, sawPhasor);
-          sawPhasor *= 0.001f;
-          if (aliasSuppress && sawMode < 3) {
+          float_4 offset = globalOffset + (phaseIn[SAW]*params[SAW_PHASE_AMT_PARAM].getValue() + params[SAW_PHASE_PARAM].getValue()*2.f)*250.f;
+          sawPhasor = phase32Phasor(phase[s], offset) * 0.001f;
+          if (antiAlias == 1 && sawMode < 3) {
             loadPhases(phases, sawPhasor, basePhaseDelta);
             sawPhasor = ifelse(lowFreq, sawPhasor, aliasSuppressedSaw(phases, denInv));
           }
-          switch (sawMode) {
-            case 0:  // exp/log
-              sawOut[s] = crossfade(sawPhasor, ifelse(shape>0.f, 11.f*sawPhasor/(10.f*simd::abs(sawPhasor)+1.f), simd::sgn(sawPhasor)*simd::pow(sawPhasor,4)), ifelse(shape>0.f, shape, -shape))*10.f-5.f;
-              break;
-            case 1:  // J Curve
-              sawOut[s] = normSigmoid(sawPhasor, -shape*0.90) * 10.f - 5.f;
-              break;
-            case 2: // S Curve
-              sawOut[s] = normSigmoid(sawPhasor*2.f-1.f, -shape*0.85) * 5.f;
-              break;
-            case 3: // Rectify
-            case 4: // Normalized Rectify
-              shape = -shape;
-              shapeSign = simd::sgn(shape);
-              sawOut[s] = sawPhasor*2.f-1.f;
-              sawOut[s] = simd::ifelse(shapeSign==0, sawOut[s], -(shapeSign*simd::abs(-sawOut[s]+shapeSign-shape)-shapeSign+shape));
-              if (sawMode==4 /*Normalized Rectify*/)
-                sawOut[s] = -((1+simd::abs(shape))*-sawOut[s]-shape);
-              sawOut[s] *= 5.f;
-              break;
-            default: // 5 morph square <--> saw <--> even
-              sawOut[s] = (sawPhasor*10.f - 5.f) * simd::ifelse(shape<0.f, 1.f + shape, 1.f); // saw component
-              // square component
-              sawPhasor = globalPhasor + (phaseIn[SAW]*params[SAW_PHASE_AMT_PARAM].getValue() + params[SAW_PHASE_PARAM].getValue()*2.f)*250.f;
-              sawPhasor = simd::fmod(sawPhasor + simd::ifelse(shape<=0.f, 500.f, 0.f), 1000.f);
-              sawPhasor = simd::ifelse(sawPhasor<0.f, sawPhasor+1000.f, sawPhasor);
-              sawOut[s] += simd::ifelse(sawPhasor<500.f, 5.f, -5.f) * simd::abs(shape) * simd::ifelse(shape<0.f, 1.f, 0.5f);
-              // sine component
-              sawPhasor = globalPhasor + (phaseIn[SAW]*params[SAW_PHASE_AMT_PARAM].getValue() + params[SAW_PHASE_PARAM].getValue()*2.f)*250.f;
-              sawPhasor = simd::fmod(sawPhasor, 1000.f);
-              sawPhasor = simd::ifelse(sawPhasor<0.f, sawPhasor+1000.f, sawPhasor);
-              sawOut[s] += simd::ifelse(shape<0.f, 0.f, sinSimd_1000(sawPhasor) * 3.175 * shape);
+          if (antiAlias == 2 && sawMode < 3) // falling step at phase 0
+            sawPhasor -= polyBlep(sawPhasor, simd::fmax(simd::fabs(basePhaseDelta), 1e-6f));
+          if (sawLUT) {
+            sawOut[s] = shapeTable[SAW].lookup(sawPhasor);
+          } else {
+            switch (sawMode) {
+              case 0:  sawOut[s] = sawCurve<0>(sawPhasor, shape); break; // exp/log
+              case 1:  sawOut[s] = sawCurve<1>(sawPhasor, shape); break; // J curve
+              case 2:  sawOut[s] = sawCurve<2>(sawPhasor, shape); break; // S curve
+              case 3:  sawOut[s] = sawCurve<3>(sawPhasor, shape); break; // Rectify
+              case 4:  sawOut[s] = sawCurve<4>(sawPhasor, shape); break; // Normalized Rectify
+              default: // 5 morph square <--> saw <--> even
+                sawOut[s] = (sawPhasor*10.f - 5.f) * simd::ifelse(shape<0.f, 1.f + shape, 1.f); // saw component
+                // square component
+                sawPhasor = phase32Phasor(phase[s], offset + simd::ifelse(shape<=0.f, 500.f, 0.f));
+                sawOut[s] += simd::ifelse(sawPhasor<500.f, 5.f, -5.f) * simd::abs(shape) * simd::ifelse(shape<0.f, 1.f, 0.5f);
+                // sine component
+                sawPhasor = phase32Phasor(phase[s], offset);
+                sawOut[s] += simd::ifelse(shape<0.f, 0.f, sinSimd_1000(sawPhasor) * 3.175 * shape);
+            }
           }
 
-          if (s==0 || inputs[SAW_LEVEL_INPUT].isPolyphonic()) {
-            levelIn[SAW] = (o && !disableOver[SAW_LEVEL_INPUT]) ? float_4::zero() : inputs[SAW_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[SAW_LEVEL_INPUT].isPolyphonic()) {
+            levelIn[SAW] = (o && !holdOver[SAW_LEVEL_INPUT]) ? float_4::zero() : inputs[SAW_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SAW_LEVEL_INPUT]){
               if (o==0) levelIn[SAW] *= oversample;
               levelIn[SAW] = levelUpSample[s][SAW].process(levelIn[SAW]);
@@ -881,16 +1239,18 @@ struct Oscillator : VenomModule {
             mixDiv += simd::fabs(level);
           }
 
-          if (s==0 || inputs[SAW_OFFSET_INPUT].isPolyphonic()) {
-            offsetIn[SAW] = (o && !disableOver[SAW_OFFSET_INPUT]) ? float_4::zero() : inputs[SAW_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
-            if (procOver[SAW_OFFSET_INPUT]){
-              if (o==0) offsetIn[SAW] *= oversample;
-              offsetIn[SAW] = offsetUpSample[s][SAW].process(offsetIn[SAW]);
-            }
-          } // else preserve prior offsetIn[SAW] value
-          sawOut[s] += clamp(offsetIn[SAW]*params[SAW_OFFSET_AMT_PARAM].getValue() + params[SAW_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
-          if (params[SAW_ASIGN_PARAM].getValue()!=0)
-            sawOut[s] *= level;  
+          if (outSaw) {
+            if (s==s0 || inputs[SAW_OFFSET_INPUT].isPolyphonic()) {
+              offsetIn[SAW] = (o && !holdOver[SAW_OFFSET_INPUT]) ? float_4::zero() : inputs[SAW_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
+              if (procOver[SAW_OFFSET_INPUT]){
+                if (o==0) offsetIn[SAW] *= oversample;
+                offsetIn[SAW] = offsetUpSample[s][SAW].process(offsetIn[SAW]);
+              }
+            } // else preserve prior offsetIn[SAW] value
+            sawOut[s] += clamp(offsetIn[SAW]*params[SAW_OFFSET_AMT_PARAM].getValue() + params[SAW_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
+            if (params[SAW_ASIGN_PARAM].getValue()!=0)
+              sawOut[s] *= level;  
+          }
         }
         
         // Mix
@@ -901,8 +1261,8 @@ struct Oscillator : VenomModule {
             folds=3;
           }
           if (mixType) {
-            if (s==0 || inputs[MIX_SHAPE_INPUT].isPolyphonic()) {
-              shapeIn[MIX] = (o && !disableOver[MIX_SHAPE_INPUT]) ? float_4::zero() : inputs[MIX_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
+            if (s==s0 || inputs[MIX_SHAPE_INPUT].isPolyphonic()) {
+              shapeIn[MIX] = (o && !holdOver[MIX_SHAPE_INPUT]) ? float_4::zero() : inputs[MIX_SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
               if (procOver[MIX_SHAPE_INPUT]){
                 if (o==0) shapeIn[MIX] *= oversample;
                 shapeIn[MIX] = shapeUpSample[s][MIX].process(shapeIn[MIX]);
@@ -921,16 +1281,16 @@ struct Oscillator : VenomModule {
               }
             }
           }
-          if (s==0 || inputs[MIX_OFFSET_INPUT].isPolyphonic()) {
-            offsetIn[MIX] = (o && !disableOver[MIX_OFFSET_INPUT]) ? float_4::zero() : inputs[MIX_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[MIX_OFFSET_INPUT].isPolyphonic()) {
+            offsetIn[MIX] = (o && !holdOver[MIX_OFFSET_INPUT]) ? float_4::zero() : inputs[MIX_OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[MIX_OFFSET_INPUT]){
               if (o==0) offsetIn[MIX] *= oversample;
               offsetIn[MIX] = offsetUpSample[s][MIX].process(offsetIn[MIX]);
             }
           } // else preserve prior offsetIn[MIX] value
           mixOut[s] += clamp(offsetIn[MIX]*params[MIX_OFFSET_AMT_PARAM].getValue() + params[MIX_OFFSET_PARAM].getValue()*5.f, -5.f, 5.f);
-          if (s==0 || inputs[MIX_LEVEL_INPUT].isPolyphonic()) {
-            levelIn[MIX] = (o && !disableOver[MIX_LEVEL_INPUT]) ? float_4::zero() : inputs[MIX_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
+          if (s==s0 || inputs[MIX_LEVEL_INPUT].isPolyphonic()) {
+            levelIn[MIX] = (o && !holdOver[MIX_LEVEL_INPUT]) ? float_4::zero() : inputs[MIX_LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[MIX_LEVEL_INPUT]){
               if (o==0) levelIn[MIX] *= oversample;
               levelIn[MIX] = levelUpSample[s][MIX].process(levelIn[MIX]);
@@ -946,42 +1306,109 @@ struct Oscillator : VenomModule {
         // FINAL PROCESSING
         // Handle one shots
         if (once){
-          sinOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), sinOut[s]);
-          triOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), triOut[s]);
-          sqrOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), sqrOut[s]);
-          sawOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), sawOut[s]);
-          mixOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), mixOut[s]);
+          if (outSin)
+            sinOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), sinOut[s]);
+          if (outTri)
+            triOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), triOut[s]);
+          if (outSqr)
+            sqrOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), sqrOut[s]);
+          if (outSaw)
+            sawOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), sawOut[s]);
+          if (procMix)
+            mixOut[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), mixOut[s]);
+        }
+        // Correct sub-sample sync discontinuities
+        if (subSampleSync && inputs[SYNC_INPUT].isConnected()) {
+          float_4 syncMask = sync>0.f;
+          if (outSin)
+            sinOut[s] = syncBlep[s][SIN].process(sinOut[s], syncMask, syncP);
+          if (outTri)
+            triOut[s] = syncBlep[s][TRI].process(triOut[s], syncMask, syncP);
+          if (outSqr)
+            sqrOut[s] = syncBlep[s][SQR].process(sqrOut[s], syncMask, syncP);
+          if (outSaw)
+            sawOut[s] = syncBlep[s][SAW].process(sawOut[s], syncMask, syncP);
+          if (procMix)
+            mixOut[s] = syncBlep[s][MIX].process(mixOut[s], syncMask, syncP);
         }
         // Remove DC offset
         if (params[DC_PARAM].getValue()) {
-          if (outputs[SIN_OUTPUT].isConnected())
-            sinOut[s] = dcBlockFilter[s][SIN].process(sinOut[s]/*, oversample*/);
-          if (outputs[TRI_OUTPUT].isConnected())
-            triOut[s] = dcBlockFilter[s][TRI].process(triOut[s]/*, oversample*/);
-          if (outputs[SQR_OUTPUT].isConnected())
-            sqrOut[s] = dcBlockFilter[s][SQR].process(sqrOut[s]/*, oversample*/);
-          if (outputs[SAW_OUTPUT].isConnected())
-            sawOut[s] = dcBlockFilter[s][SAW].process(sawOut[s]/*, oversample*/);
-          if (outputs[MIX_OUTPUT].isConnected())
-            mixOut[s] = dcBlockFilter[s][MIX].process(mixOut[s]/*, oversample*/);
+          if (outSin)
+            sinOut[s] = dcBlockFilter[s][SIN].process(sinOut[s], dcCoef);
+          if (outTri)
+            triOut[s] = dcBlockFilter[s][TRI].process(triOut[s], dcCoef);
+          if (outSqr)
+            sqrOut[s] = dcBlockFilter[s][SQR].process(sqrOut[s], dcCoef);
+          if (outSaw)
+            sawOut[s] = dcBlockFilter[s][SAW].process(sawOut[s], dcCoef);
+          if (procMix)
+            mixOut[s] = dcBlockFilter[s][MIX].process(mixOut[s], dcCoef);
         }
         // Downsample outputs
         if (oversample>1) {
-          if (outputs[SIN_OUTPUT].isConnected())
+          if (outSin)
             sinOut[s] = outDownSample[s][SIN].process(sinOut[s]);
-          if (outputs[TRI_OUTPUT].isConnected())
+          if (outTri)
             triOut[s] = outDownSample[s][TRI].process(triOut[s]);
-          if (outputs[SQR_OUTPUT].isConnected())
+          if (outSqr)
             sqrOut[s] = outDownSample[s][SQR].process(sqrOut[s]);
-          if (outputs[SAW_OUTPUT].isConnected())
+          if (outSaw)
             sawOut[s] = outDownSample[s][SAW].process(sawOut[s]);
-          if (outputs[MIX_OUTPUT].isConnected())
+          if (procMix)
             mixOut[s] = outDownSample[s][MIX].process(mixOut[s]);
         }
       }
     }
+    for (int s=0; s<4; s++) {
+      // outputs that are not connected are not checked, they may hold waves that only feed the Mix
+      float_4 peak = procMix ? simd::fabs(mixOut[s]) : float_4::zero();
+      if (outSin)
+        peak = simd::fmax(peak, simd::fabs(sinOut[s]));
+      if (outTri)
+        peak = simd::fmax(peak, simd::fabs(triOut[s]));
+      if (outSqr)
+        peak = simd::fmax(peak, simd::fabs(sqrOut[s]));
+      if (outSaw)
+        peak = simd::fmax(peak, simd::fabs(sawOut[s]));
+      groupQuiet[s] = once && s<simdCnt && !simd::movemask(peak > 1e-5f);
+    }
+    pitchBlockReset = !pitchBlock;
     
-    float_4 out{};
+    if (lfoRate) {
+      // Ramp from the current output so it reaches the value predicted by the slope since the
+      // previous compute one sample before the next compute. Jump to the new value when a trigger
+      // forced the compute, a one shot started or ended, or the prediction missed by more than half
+      // of the last period's movement (square edges, saw resets, triangle corners), then compute
+      // again on the next sample to measure the new slope rather than holding the jump value.
+      int onceMask = 0;
+      for (int s=0; once && s<simdCnt; s++)
+        onceMask |= simd::movemask(onceActive[s] != float_4::zero()) << (s*4);
+      lfoSnap |= onceMask != lfoOnceMask;
+      lfoOnceMask = onceMask;
+      bool resume = lfoResume;
+      lfoResume = false;
+      float_4* lfoNew[5] = {sinOut, triOut, sqrOut, sawOut, mixOut};
+      for (int s=0; s<simdCnt; s++) {
+        for (int j=0; j<5; j++) {
+          float_4 snap = lfoSnap ? float_4::mask() : lfoMiss(lfoNew[j][s], lfoOut[s][j], lfoStep[s][j], resume);
+          lfoRamp(lfoNew[j][s], lfoOut[s][j], lfoStep[s][j], lfoPrev[s][j], snap, lfoElapsed);
+          lfoResume |= simd::movemask(snap);
+          lfoNew[j][s] = lfoOut[s][j];
+        }
+      }
+      lfoNext = lfoResume ? 1 : lfoDivision;
+      lfoChannels = channels;
+      lfoJump = false;
+    }
+
+    if (watchdogEnabled) {
+      for (int s=0; s<simdCnt; s++) {
+        float_4 out[5] = {sinOut[s], triOut[s], sqrOut[s], sawOut[s], mixOut[s]};
+        if (groupWatchdog(s, out))
+          sinOut[s] = triOut[s] = sqrOut[s] = sawOut[s] = mixOut[s] = float_4::zero();
+      }
+    }
+
     for (int s=0, c=0; s<simdCnt; s++, c+=4) {
       outputs[SIN_OUTPUT].setVoltageSimd( sinOut[s], c );
       outputs[TRI_OUTPUT].setVoltageSimd( triOut[s], c );
@@ -1022,6 +1449,12 @@ struct Oscillator : VenomModule {
     json_object_set_new(rootJ, "clampLevel", json_boolean(clampLevel));
     json_object_set_new(rootJ, "syncAt0", json_boolean(syncLo<0.f));
     json_object_set_new(rootJ, "disableDPW", json_boolean(disableDPW));
+    json_object_set_new(rootJ, "polyBlep", json_boolean(polyBlep));
+    json_object_set_new(rootJ, "subSampleSync", json_boolean(subSampleSync));
+    json_object_set_new(rootJ, "pitchBlockInterp", json_boolean(pitchBlockInterp));
+    json_object_set_new(rootJ, "autoOver", json_boolean(autoOver));
+    json_object_set_new(rootJ, "shapeLUT", json_boolean(shapeLUT));
+    json_object_set_new(rootJ, "lfoControlRate", json_boolean(lfoControlRate));
     return rootJ;
   }
 
@@ -1071,12 +1504,24 @@ struct Oscillator : VenomModule {
     }
     val = json_object_get(rootJ, "disableDPW");
     disableDPW = val ? json_boolean_value(val) : true;
+    val = json_object_get(rootJ, "polyBlep");
+    polyBlep = val ? json_boolean_value(val) : false;
     setMode();
     if ((val = json_object_get(rootJ, "overParam"))) {
       params[OVER_PARAM].setValue(json_integer_value(val));
     }
     val = json_object_get(rootJ, "clampLevel");
     clampLevel = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "subSampleSync");
+    subSampleSync = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "pitchBlockInterp");
+    pitchBlockInterp = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "autoOver");
+    autoOver = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "shapeLUT");
+    shapeLUT = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "lfoControlRate");
+    lfoControlRate = val ? json_boolean_value(val) : false;
   }
   
 };
@@ -1291,19 +1736,19 @@ struct OscillatorWidget : VenomWidget {
     VenomWidget::step();
     Oscillator* mod = dynamic_cast<Oscillator*>(this->module);
     if(mod) {
-      bool over = mod->params[Oscillator::OVER_PARAM].getValue();
-      mod->lights[Oscillator::REV_LIGHT].setBrightness(over && !(mod->disableOver[Oscillator::REV_INPUT]) && mod->inputs[Oscillator::REV_INPUT].isConnected());
-      mod->lights[Oscillator::REV_LIGHT+1].setBrightness(over && mod->disableOver[Oscillator::REV_INPUT] && mod->inputs[Oscillator::REV_INPUT].isConnected());
-      mod->lights[Oscillator::EXP_LIGHT].setBrightness(over && !(mod->disableOver[Oscillator::EXP_INPUT]) && mod->inputs[Oscillator::EXP_INPUT].isConnected() && !(mod->alternate));
-      mod->lights[Oscillator::EXP_LIGHT+1].setBrightness(over && mod->disableOver[Oscillator::EXP_INPUT] && mod->inputs[Oscillator::EXP_INPUT].isConnected() && !(mod->alternate));
-      mod->lights[Oscillator::LIN_LIGHT].setBrightness(over && !(mod->disableOver[Oscillator::LIN_INPUT]) && mod->inputs[Oscillator::LIN_INPUT].isConnected());
-      mod->lights[Oscillator::LIN_LIGHT+1].setBrightness(over && mod->disableOver[Oscillator::LIN_INPUT] && mod->inputs[Oscillator::LIN_INPUT].isConnected());
-      mod->lights[Oscillator::SYNC_LIGHT].setBrightness(over && !(mod->disableOver[Oscillator::SYNC_INPUT]) && mod->inputs[Oscillator::SYNC_INPUT].isConnected());
-      mod->lights[Oscillator::SYNC_LIGHT+1].setBrightness(over && mod->disableOver[Oscillator::SYNC_INPUT] && mod->inputs[Oscillator::SYNC_INPUT].isConnected());
+      bool over = mod->params[Oscillator::OVER_PARAM].getValue() && !mod->lfoRate;
+      mod->lights[Oscillator::REV_LIGHT].setBrightness(over && !(mod->disableOver[Oscillator::REV_INPUT] || mod->autoSlow[Oscillator::REV_INPUT]) && mod->inputs[Oscillator::REV_INPUT].isConnected());
+      mod->lights[Oscillator::REV_LIGHT+1].setBrightness(over && (mod->disableOver[Oscillator::REV_INPUT] || mod->autoSlow[Oscillator::REV_INPUT]) && mod->inputs[Oscillator::REV_INPUT].isConnected());
+      mod->lights[Oscillator::EXP_LIGHT].setBrightness(over && !(mod->disableOver[Oscillator::EXP_INPUT] || mod->autoSlow[Oscillator::EXP_INPUT] || mod->pitchBlockInterp) && mod->inputs[Oscillator::EXP_INPUT].isConnected() && !(mod->alternate));
+      mod->lights[Oscillator::EXP_LIGHT+1].setBrightness(over && (mod->disableOver[Oscillator::EXP_INPUT] || mod->autoSlow[Oscillator::EXP_INPUT] || mod->pitchBlockInterp) && mod->inputs[Oscillator::EXP_INPUT].isConnected() && !(mod->alternate));
+      mod->lights[Oscillator::LIN_LIGHT].setBrightness(over && !(mod->disableOver[Oscillator::LIN_INPUT] || mod->autoSlow[Oscillator::LIN_INPUT]) && mod->inputs[Oscillator::LIN_INPUT].isConnected());
+      mod->lights[Oscillator::LIN_LIGHT+1].setBrightness(over && (mod->disableOver[Oscillator::LIN_INPUT] || mod->autoSlow[Oscillator::LIN_INPUT]) && mod->inputs[Oscillator::LIN_INPUT].isConnected());
+      mod->lights[Oscillator::SYNC_LIGHT].setBrightness(over && !(mod->disableOver[Oscillator::SYNC_INPUT] || mod->autoSlow[Oscillator::SYNC_INPUT] || mod->subSampleSync) && mod->inputs[Oscillator::SYNC_INPUT].isConnected());
+      mod->lights[Oscillator::SYNC_LIGHT+1].setBrightness(over && (mod->disableOver[Oscillator::SYNC_INPUT] || mod->autoSlow[Oscillator::SYNC_INPUT] || mod->subSampleSync) && mod->inputs[Oscillator::SYNC_INPUT].isConnected());
       for (int y=0; y<4; y++) {
         for (int x=0; x<5; x++) {
-          mod->lights[Oscillator::GRID_LIGHT+y*10+x*2].setBrightness(over && !(mod->disableOver[Oscillator::GRID_INPUT+y*5+x]) && mod->inputs[Oscillator::GRID_INPUT+y*5+x].isConnected());
-          mod->lights[Oscillator::GRID_LIGHT+y*10+x*2+1].setBrightness(over && mod->disableOver[Oscillator::GRID_INPUT+y*5+x] && mod->inputs[Oscillator::GRID_INPUT+y*5+x].isConnected());
+          mod->lights[Oscillator::GRID_LIGHT+y*10+x*2].setBrightness(over && !(mod->disableOver[Oscillator::GRID_INPUT+y*5+x] || mod->autoSlow[Oscillator::GRID_INPUT+y*5+x]) && mod->inputs[Oscillator::GRID_INPUT+y*5+x].isConnected());
+          mod->lights[Oscillator::GRID_LIGHT+y*10+x*2+1].setBrightness(over && (mod->disableOver[Oscillator::GRID_INPUT+y*5+x] || mod->autoSlow[Oscillator::GRID_INPUT+y*5+x]) && mod->inputs[Oscillator::GRID_INPUT+y*5+x].isConnected());
         }
       }
       mod->lights[Oscillator::LIN_DC_LIGHT].setBrightness(mod->linDCCouple);
@@ -1314,15 +1759,16 @@ struct OscillatorWidget : VenomWidget {
     Oscillator* module = dynamic_cast<Oscillator*>(this->module);
     menu->addChild(new MenuSeparator);
     menu->addChild(createBoolPtrMenuItem("Limit levels to 100%", "", &module->clampLevel));
-    menu->addChild(createBoolMenuItem("Disable DPW anti-alias", "",
-      [=]() {
-        return module->disableDPW;
-      },
-      [=](bool val) {
-        module->disableDPW = val;
+    menu->addChild(createIndexSubmenuItem(
+      "Anti-alias",
+      {"DPW", "polyBLEP / polyBLAMP", "Off"},
+      [=]() {return module->disableDPW ? 2 : module->polyBlep ? 1 : 0;},
+      [=](int val) {
+        module->disableDPW = val==2;
+        module->polyBlep = val==1;
         module->setMode(true);
       }
-    ));    
+    ));
     menu->addChild(createIndexSubmenuItem(
       "Sync trigger threshold",
       {"High 2V, Low 0.2V", "High 0V, Low -2V"},
@@ -1332,6 +1778,11 @@ struct OscillatorWidget : VenomWidget {
         module->syncLo = val ? -2.f : 0.2f;
       }
     ));
+    menu->addChild(createBoolPtrMenuItem("Sub-sample sync (sync input not oversampled)", "", &module->subSampleSync));
+    menu->addChild(createBoolPtrMenuItem("Interpolate oversampled pitch (exponential FM not oversampled)", "", &module->pitchBlockInterp));
+    menu->addChild(createBoolPtrMenuItem("Automatic input oversampling (slow CV not oversampled)", "", &module->autoOver));
+    menu->addChild(createBoolPtrMenuItem("Shape lookup tables (unmodulated curves)", "", &module->shapeLUT));
+    menu->addChild(createBoolPtrMenuItem("Control rate low frequency modes (no oversampling)", "", &module->lfoControlRate));
     VenomWidget::appendContextMenu(menu);
   }
 
@@ -34,6 +34,11 @@ struct QuadVCPolarizer : VenomModule {
   int oversampleEnd = 0;
   int oversampleValues[6]{1,2,4,8,16,32};
   OversampleFilter_4 inUpSample[4][4]{}, cvUpSample[4][4]{}, outDownSample[4][4]{};
+  // Routing, rebuilt when the output connections change. Each port sums into the next connected
+  // output at or below it, so an unpatched output passes its port down to the next one.
+  int routeMask = -1;
+  int outPort[4]{-1, -1, -1, -1};
+  int portState[4]{}; // bit 0 active, bit 1 CV oversampled, bit 2 input oversampled
   
   QuadVCPolarizer() {
     venomConfig(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -66,51 +71,87 @@ struct QuadVCPolarizer : VenomModule {
   void process(const ProcessArgs& args) override {
     VenomModule::process(args);
     using float_4 = simd::float_4;
-    int channels[4]{}, outPort[4]{-1,-1,-1,-1};
     if (oversample != oversampleValues[static_cast<int>(params[OVER_PARAM].getValue())]) {
       oversample = oversampleValues[static_cast<int>(params[OVER_PARAM].getValue())];
       oversampleEnd = oversample-1;
       setOversample();
     }
-    for (int i=3, j=2; i>=0; i=j--){
-      if (outputs[POLY_OUTPUT+i].isConnected()){
-        outPort[i] = i;
-        channels[i] = std::max({1, inputs[POLY_INPUT+i].getChannels(), inputs[LEVEL_INPUT+i].getChannels()});
-        for (; j>=0 && !outputs[POLY_OUTPUT+j].isConnected(); j--){
-          outPort[j] = i;
-          channels[i] = std::max({channels[i], inputs[POLY_INPUT+j].getChannels(), inputs[LEVEL_INPUT+j].getChannels()});
-        }
+    int mask = 0;
+    for (int i=0; i<4; i++)
+      mask |= outputs[POLY_OUTPUT+i].isConnected() << i;
+    if (mask != routeMask) {
+      routeMask = mask;
+      for (int i=3, k=-1; i>=0; i--){
+        if (mask & (1 << i))
+          k = i;
+        outPort[i] = k;
       }
     }
+    int channels[4]{};
+    for (int i=0; i<4 && outPort[i]>=0; i++)
+      channels[outPort[i]] = std::max({channels[outPort[i]], 1, inputs[POLY_INPUT+i].getChannels(), inputs[LEVEL_INPUT+i].getChannels()});
     float norm = params[NORM_PARAM].getValue() ? 10.f : 5.f;
     float unity = params[UNITY_PARAM].getValue() ? 10.f : 5.f;
     int vca = static_cast<int>(params[VCA_MODE_PARAM].getValue());
     int clip = static_cast<int>(params[CLIP_PARAM].getValue());
+
+    // Per port setup. A port with neither CV nor level adds nothing and is skipped, and only
+    // connected inputs are oversampled since an unpatched input or CV is constant.
+    float level[4]{}, amt[4]{};
+    bool active[4]{}, cvConnected[4]{}, cvPoly[4]{}, cvOver[4]{}, inPoly[4]{}, inOver[4]{};
+    for (int i=0; i<4 && outPort[i]>=0; i++){
+      level[i] = params[LEVEL_PARAM+i].getValue();
+      amt[i] = params[LEVEL_AMT_PARAM+i].getValue()/unity;
+      cvConnected[i] = inputs[LEVEL_INPUT+i].isConnected();
+      cvPoly[i] = inputs[LEVEL_INPUT+i].isPolyphonic();
+      inPoly[i] = inputs[POLY_INPUT+i].isPolyphonic();
+      active[i] = cvConnected[i] || level[i] != 0.f;
+      cvOver[i] = active[i] && cvConnected[i] && oversample>1;
+      inOver[i] = active[i] && inputs[POLY_INPUT+i].isConnected() && oversample>1;
+      // filters that resume are cleared, rather than continuing from stale state
+      int state = active[i] | cvOver[i] << 1 | inOver[i] << 2;
+      if (state != portState[i]){
+        for (int j=0; j<4; j++){
+          if (cvOver[i] && !(portState[i] & 2)) cvUpSample[i][j].reset();
+          if (inOver[i] && !(portState[i] & 4)) inUpSample[i][j].reset();
+        }
+        portState[i] = state;
+      }
+    }
+
+    float_4 in[4][4], cv[4][4]; // held across the oversample steps when not oversampled
     for (int o=0; o<oversample; o++){
       float_4 out[4][4]{};
       for (int i=0; i<4 && outPort[i]>=0; i++){
-        float_4 cv{};
-        float_4 in{};
-        for (int c=0, j=0; c<channels[outPort[i]]; c+=4, j++){
-          if (c==0 || inputs[LEVEL_INPUT+i].isPolyphonic()){
-            cv = o ? float_4::zero() : inputs[LEVEL_INPUT+i].getPolyVoltageSimd<float_4>(c);
-            if (oversample>1){
-              if (!o) cv*=oversample;
-              cv = cvUpSample[i][j].process(cv);
+        int k = outPort[i];
+        if (active[i]){
+          for (int c=0, j=0; c<channels[k]; c+=4, j++){
+            if ((j==0 || cvPoly[i]) && (!o || cvOver[i])){
+              if (cvConnected[i]){
+                cv[i][j] = o ? float_4::zero() : inputs[LEVEL_INPUT+i].getPolyVoltageSimd<float_4>(c);
+                if (cvOver[i]){
+                  if (!o) cv[i][j]*=oversample;
+                  cv[i][j] = cvUpSample[i][j].process(cv[i][j]);
+                }
+                cv[i][j] *= amt[i];
+                if (vca<2)
+                  cv[i][j] = simd::clamp(cv[i][j], vca ? -1.f : 0.f, 1.f);
+              }
+              else cv[i][j] = float_4::zero();
             }
-          }
-          cv *= params[LEVEL_AMT_PARAM+i].getValue()/unity;
-          if (vca<2)
-            cv = simd::clamp(cv, vca ? -1.f : 0.f, 1.f);
-          if (c==0 || inputs[POLY_INPUT+i].isPolyphonic()){
-            in = o ? float_4::zero() : inputs[POLY_INPUT+i].getNormalPolyVoltageSimd<float_4>(norm, c);
-            if (oversample>1){
-              if (!o) in*=oversample;
-              in = inUpSample[i][j].process(in);
+            if ((j==0 || inPoly[i]) && (!o || inOver[i])){
+              in[i][j] = o ? float_4::zero() : inputs[POLY_INPUT+i].getNormalPolyVoltageSimd<float_4>(norm, c);
+              if (inOver[i]){
+                if (!o) in[i][j]*=oversample;
+                in[i][j] = inUpSample[i][j].process(in[i][j]);
+              }
             }
+            out[k][j] += in[i][inPoly[i] ? j : 0] * simd::clamp(cv[i][cvPoly[i] ? j : 0] + level[i], -2.f, 2.f);
           }
-          out[outPort[i]][j] += in * simd::clamp(cv + params[LEVEL_PARAM+i].getValue(), -2.f, 2.f);
-          if (i == outPort[i]){
+        }
+        if (i == k){
+          // all ports summed into this output are done, so clip and downsample in the same pass
+          for (int c=0, j=0; c<channels[i]; c+=4, j++){
             switch(clip) {
               case 1: // hard 10V
                 out[i][j] = clamp(out[i][j], -10.f, 10.f);
@@ -126,12 +167,12 @@ struct QuadVCPolarizer : VenomModule {
             }
             if (oversample>1)
               out[i][j] = outDownSample[i][j].process(out[i][j]);
-            if (o==oversampleEnd)  
+            if (o==oversampleEnd)
               outputs[POLY_OUTPUT+i].setVoltageSimd(out[i][j], c);
           }
+          if (o==oversampleEnd)
+            outputs[POLY_OUTPUT+i].setChannels(channels[i]);
         }
-        if (o==oversampleEnd && i == outPort[i])
-          outputs[POLY_OUTPUT+i].setChannels(channels[i]);
       }
     }
   }
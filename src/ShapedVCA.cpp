@@ -50,6 +50,91 @@ struct ShapedVCA : VenomModule {
                      leftUpSample[4], rightUpSample[4], 
                      leftDownSample[4], rightDownSample[4];
 
+  // A group whose gain is exactly zero is closed. Once closed long enough for the oversampling filter
+  // tails to decay, the filters are cleared and the group is skipped until it opens again.
+  static const int closedHold = 64;
+  int closedCnt[4]{};
+
+  // Smart oversampling: the VCA is linear in the audio unless the gain is modulated at audio rate,
+  // so only audio rate level or curve CV oversamples everything. Otherwise only the clipper is
+  // oversampled, by upsampling the VCA output, or nothing when clipping is off.
+  // SmartPathSelector crossfades the path changes, and only drops to a cheaper path after a short
+  // hold. The path that is not oversampled is delayed to match the latency of the oversampling filters.
+  bool smartOver = false;
+  SmartPathSelector smartPath; // 0 = none, 1 = clipper only, 2 = full
+  AudioRateDetector levelDetector, curveDetector;
+  OversampleFilter_4 clipUpSample[2][4], clipDownSample[2][4]; // left and right, clipper only path
+  simd::float_4 compDelay[2][4][8]{};
+  int compPos = 0, compLen = 0;
+
+  // Clears the state of one path for group s, or for every group
+  void resetPath(int path, int s = -1) {
+    for (int i=0; i<4; i++) {
+      if (s >= 0 && i != s)
+        continue;
+      if (path == 2) {
+        levelUpSample[i].reset();
+        curveUpSample[i].reset();
+        leftUpSample[i].reset();
+        rightUpSample[i].reset();
+        leftDownSample[i].reset();
+        rightDownSample[i].reset();
+      }
+      if (path == 1) {
+        for (int j=0; j<2; j++) {
+          clipUpSample[j][i].reset();
+          clipDownSample[j][i].reset();
+        }
+      }
+      if (path == 0) {
+        for (int j=0; j<2; j++)
+          for (int k=0; k<8; k++)
+            compDelay[j][i][k] = simd::float_4::zero();
+      }
+    }
+  }
+
+  // Gain curve kernels, specialized on the exp/log algorithm (ALGO) and on the curve (CURVE).
+  // CURVE 0 = modulated, 1 = linear, 2 = log, 3 = exp. The response crossfades linearly from the level
+  // toward the log (curve > 0) or exp (curve < 0) curve, so an unmodulated curve only computes the
+  // one curve it uses, or none when centered. shape is the curve for CURVE 0, else its magnitude.
+
+  template <int ALGO, int CURVE>
+  static simd::float_4 gainCurve(simd::float_4 x, simd::float_4 shape) {
+    using float_4 = simd::float_4;
+    if (CURVE == 1)
+      return x;
+    float_4 lg{}, ex{};
+    if (CURVE != 3) // log
+      lg = ALGO == 2 ? 11.f*x/(10.f*x+1.f) : 11.f*x/(10.f*simd::abs(x)+1.f);
+    if (CURVE != 2) // exp
+      ex = ALGO == 0 ? simd::sgn(x)*simd::pow(x,4) : simd::pow(x,4);
+    if (CURVE == 2)
+      return crossfade(x, lg, shape);
+    if (CURVE == 3)
+      return crossfade(x, ex, shape);
+    return crossfade(x, ifelse(shape>0.f, lg, ex), ifelse(shape>0.f, shape, -shape));
+  }
+
+  // A switch on kernelId = ALGO*4 + CURVE, which only changes between samples, so the branch is
+  // well predicted and each case inlines its kernel
+  static simd::float_4 gainKernel(int kernelId, simd::float_4 x, simd::float_4 shape) {
+    switch (kernelId) {
+      case 0:  return gainCurve<0, 0>(x, shape);
+      case 1:  return gainCurve<0, 1>(x, shape);
+      case 2:  return gainCurve<0, 2>(x, shape);
+      case 3:  return gainCurve<0, 3>(x, shape);
+      case 4:  return gainCurve<1, 0>(x, shape);
+      case 5:  return gainCurve<1, 1>(x, shape);
+      case 6:  return gainCurve<1, 2>(x, shape);
+      case 7:  return gainCurve<1, 3>(x, shape);
+      case 8:  return gainCurve<2, 0>(x, shape);
+      case 9:  return gainCurve<2, 1>(x, shape);
+      case 10: return gainCurve<2, 2>(x, shape);
+      default: return gainCurve<2, 3>(x, shape);
+    }
+  }
+
   ShapedVCA() {
     venomConfig(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
     configSwitch<FixedSwitchQuantity>(RANGE_PARAM, 0.f, 5.f, 0.f, "Level Range", {"0-1", "0-2", "0-10", "+/- 1", "+/- 2", "+/- 10"});
@@ -75,6 +160,7 @@ struct ShapedVCA : VenomModule {
     configBypass(inputs[RIGHT_INPUT].isConnected() ? RIGHT_INPUT : LEFT_INPUT, RIGHT_OUTPUT);
     
     oversampleStages = 5;
+    watchdogAvailable = true;
   }
 
   void onPortChange(const PortChangeEvent& e) override {
@@ -90,7 +176,13 @@ struct ShapedVCA : VenomModule {
       rightUpSample[i].setOversample(oversample, oversampleStages);
       leftDownSample[i].setOversample(oversample, oversampleStages);
       rightDownSample[i].setOversample(oversample, oversampleStages);
+      for (int j=0; j<2; j++) {
+        clipUpSample[j][i].setOversample(oversample, oversampleStages);
+        clipDownSample[j][i].setOversample(oversample, oversampleStages);
+      }
     }
+    // an up and a down filter, rounded to whole samples
+    compLen = std::min(static_cast<int>(2.f * leftUpSample[0].latency + 0.5f), 7);
   }
 
   void process(const ProcessArgs& args) override {
@@ -122,7 +214,7 @@ struct ShapedVCA : VenomModule {
     float offset = offsetVals[static_cast<int>(params[OFFSET_PARAM].getValue())];
     int clip = static_cast<int>(params[CLIP_PARAM].getValue());
     using float_4 = simd::float_4;
-    float_4 leftIn[4], rightIn[4], levelIn[4], curveIn[4], gain, shape, leftOut[4], rightOut[4];
+    float_4 leftOut[4], rightOut[4];
     bool leftInConnected = inputs[LEFT_INPUT].isConnected(),
          rightInConnected = inputs[RIGHT_INPUT].isConnected(),
          levelConnected = inputs[LEVEL_INPUT].isConnected(),
@@ -131,45 +223,136 @@ struct ShapedVCA : VenomModule {
          rightOutConnected = outputs[RIGHT_OUTPUT].isConnected(),
          ringMod = (static_cast<int>(params[MODE_PARAM].getValue())%2),
          half = params[MODE_PARAM].getValue()>1.5f;
+    int gainAlgo = half ? 0 : algo; // half range modes always use the corrected algorithm
+    int curveMode = curveConnected ? 0 : curve > 0.f ? 2 : curve < 0.f ? 3 : 1;
+    int gainKernelId = gainAlgo*4 + curveMode;
+    float_4 curveMag = std::fabs(curve);
+    // With the level CV unpatched and no bias the level is 1, where every curve has unity gain
+    bool unity = !levelConnected && bias == 0.f;
 
-    for( int o=0; o<oversample; o++){
-      for( int s=0, c=0; s<simdCnt; s++, c+=4){
-        curveIn[s] = curveConnected && !o ? inputs[CURVE_INPUT].getPolyVoltageSimd<float_4>(c) * oversample : float_4::zero(); // normal value is 0.f, so this simpler logic works
-        levelIn[s] = levelConnected ? (o ? float_4::zero() : inputs[LEVEL_INPUT].getPolyVoltageSimd<float_4>(c)/10.f * oversample) : 1.f; // normal is non-zero, so a bit more logic needed
-        leftIn[s] = leftInConnected ? (o ? float_4::zero() : inputs[LEFT_INPUT].getPolyVoltageSimd<float_4>(c) * oversample) : 10.f; // normal is non-zero, so a bit more logic needed
-        if (rightInConnected) rightIn[s] = o ? float_4::zero() : inputs[RIGHT_INPUT].getPolyVoltageSimd<float_4>(c) * oversample; // normal is left, so set later if not connected
-        if (oversample>1) {
-          if (curveConnected) curveIn[s] = curveUpSample[s].process(curveIn[s]);
-          if (levelConnected) levelIn[s] = levelUpSample[s].process(levelIn[s]);
-          if (leftInConnected) leftIn[s] = leftUpSample[s].process(leftIn[s]);
-          if (rightInConnected) rightIn[s] = rightUpSample[s].process(rightIn[s]);
-        } 
-        if (!rightInConnected) rightIn[s] = leftIn[s];
-        levelIn[s] += bias;
-        if (!ringMod) levelIn[s] = clamp(levelIn[s]);
-        shape = clamp(curveIn[s]/10.f + curve, -1.f, 1.f);
-        if (algo == 2 && !half) // oldlog and unscaled, unipolar exp
-          gain = crossfade(levelIn[s], ifelse(shape>0.f, 11.f*levelIn[s]/(10.f*levelIn[s]+1.f), simd::pow(levelIn[s],4)), ifelse(shape>0.f, shape, -shape));
-        else if (algo == 1 && !half)
-          gain = crossfade(levelIn[s], ifelse(shape>0.f, 11.f*levelIn[s]/(10.f*simd::abs(levelIn[s])+1.f), simd::pow(levelIn[s],4)), ifelse(shape>0.f, shape, -shape));
-        else {
-          if (half && levelConnected)
-            levelIn[s]*=2.f;
-          gain = crossfade(levelIn[s], ifelse(shape>0.f, 11.f*levelIn[s]/(10.f*simd::abs(levelIn[s])+1.f), simd::sgn(levelIn[s])*simd::pow(levelIn[s],4)), ifelse(shape>0.f, shape, -shape));
+    // path 0 = not oversampled, 1 = clipper only, 2 = full
+    int path = oversample > 1 ? 2 : 0;
+    if (smartOver && oversample > 1) {
+      bool gainAudio = levelConnected && levelDetector.process(inputs[LEVEL_INPUT], args.sampleRate);
+      if (curveConnected && !unity && curveDetector.process(inputs[CURVE_INPUT], args.sampleRate))
+        gainAudio = true;
+      int state = gainAudio ? 2 : clip ? 1 : 0;
+      if (smartPath.path < 0)
+        smartPath.start(2); // the path that ran before smart oversampling, faded out if not needed
+      if (smartPath.process(state, args.sampleRate))
+        resetPath(smartPath.path);
+      path = smartPath.path;
+    }
+    else {
+      smartPath.reset();
+    }
+    bool compensate = path == 0 && smartPath.path >= 0;
+
+    bool closed[4]{};
+    for (int s=0, c=0; s<simdCnt; s++, c+=4){
+      bool zero = level == 0.f;
+      if (!zero && levelConnected) {
+        float_4 raw = inputs[LEVEL_INPUT].getPolyVoltageSimd<float_4>(c)/10.f + bias;
+        if (!ringMod) raw = clamp(raw);
+        zero = !simd::movemask(raw != 0.f);
+      }
+      if (!zero)
+        closedCnt[s] = 0;
+      else if (closedCnt[s] <= closedHold)
+        closedCnt[s]++;
+      closed[s] = zero && ((path == 0 && !compensate && !smartPath.fade) || closedCnt[s] >= closedHold);
+      if (closedCnt[s] == closedHold) {
+        for (int p=0; p<3; p++)
+          resetPath(p, s);
+      }
+      if (closed[s])
+        leftOut[s] = rightOut[s] = float_4::zero();
+    }
+
+    // One base rate sample of group s through a path
+    auto render = [&](int path, int s, int c, float_4& left, float_4& right) {
+      int over = path ? oversample : 1;
+      float inScale = path == 2 ? over : 1.f;
+      float_4 leftIn, rightIn, levelIn, curveIn;
+      for (int o=0; o<over; o++){
+        if (path != 1 || !o) {
+          curveIn = curveConnected && !o && !unity ? inputs[CURVE_INPUT].getPolyVoltageSimd<float_4>(c) * inScale : float_4::zero(); // normal value is 0.f, so this simpler logic works
+          levelIn = levelConnected ? (o ? float_4::zero() : inputs[LEVEL_INPUT].getPolyVoltageSimd<float_4>(c)/10.f * inScale) : 1.f; // normal is non-zero, so a bit more logic needed
+          leftIn = leftInConnected ? (o ? float_4::zero() : inputs[LEFT_INPUT].getPolyVoltageSimd<float_4>(c) * inScale) : 10.f; // normal is non-zero, so a bit more logic needed
+          if (rightInConnected) rightIn = o ? float_4::zero() : inputs[RIGHT_INPUT].getPolyVoltageSimd<float_4>(c) * inScale; // normal is left, so set later if not connected
+          if (path == 2) {
+            if (curveConnected && !unity) curveIn = curveUpSample[s].process(curveIn);
+            if (levelConnected) levelIn = levelUpSample[s].process(levelIn);
+            if (leftInConnected) leftIn = leftUpSample[s].process(leftIn);
+            if (rightInConnected) rightIn = rightUpSample[s].process(rightIn);
+          } 
+          if (!rightInConnected) rightIn = leftIn;
+          if (unity) {
+            left = leftIn * level;
+            right = rightIn * level;
+          } else {
+            levelIn += bias;
+            if (!ringMod) levelIn = clamp(levelIn);
+            float_4 shape = curveConnected ? clamp(curveIn/10.f + curve, -1.f, 1.f) : curveMag;
+            if (half && levelConnected)
+              levelIn*=2.f;
+            float_4 gain = gainKernel(gainKernelId, levelIn, shape);
+            left = leftIn * gain * level;
+            right = rightIn * gain * level;
+          }
+        }
+        if (path == 1) {
+          left = clipUpSample[0][s].process(o ? float_4::zero() : left * over);
+          right = clipUpSample[1][s].process(o ? float_4::zero() : right * over);
         }
-        leftOut[s] = leftIn[s] * gain * level;
-        rightOut[s] = rightIn[s] * gain * level;
         if (clip == HARD_CLIP){
-          leftOut[s] = clamp(leftOut[s], -10.f, 10.f);
-          rightOut[s] = clamp(rightOut[s], -10.f, 10.f);
+          left = clamp(left, -10.f, 10.f);
+          right = clamp(right, -10.f, 10.f);
         }
         if (clip == SOFT_CLIP){
-          leftOut[s] = softClip(leftOut[s]);
-          rightOut[s] = softClip(rightOut[s]);
+          left = softClip(left);
+          right = softClip(right);
         }
-        if (oversample>1) {
-          if (leftOutConnected) leftOut[s] = leftDownSample[s].process(leftOut[s]);
-          if (rightOutConnected) rightOut[s] = rightDownSample[s].process(rightOut[s]);
+        if (path == 2) {
+          if (leftOutConnected) left = leftDownSample[s].process(left);
+          if (rightOutConnected) right = rightDownSample[s].process(right);
+        }
+        if (path == 1) {
+          if (leftOutConnected) left = clipDownSample[0][s].process(left);
+          if (rightOutConnected) right = clipDownSample[1][s].process(right);
+        }
+      }
+      // Delay the path that is not oversampled by the latency of the oversampling filters,
+      // so the smart paths stay aligned
+      if (path == 0 && smartPath.path >= 0) {
+        compDelay[0][s][compPos] = left;
+        compDelay[1][s][compPos] = right;
+        left = compDelay[0][s][(compPos - compLen) & 7];
+        right = compDelay[1][s][(compPos - compLen) & 7];
+      }
+    };
+
+    // A smart path change crossfades from the prior path, which keeps running until the fade ends
+    float fade = smartPath.fadeGain();
+    for (int s=0, c=0; s<simdCnt; s++, c+=4){
+      if (closed[s])
+        continue;
+      render(path, s, c, leftOut[s], rightOut[s]);
+      if (smartPath.fade) {
+        float_4 prevLeft, prevRight;
+        render(smartPath.prev, s, c, prevLeft, prevRight);
+        leftOut[s] = crossfade(leftOut[s], prevLeft, fade);
+        rightOut[s] = crossfade(rightOut[s], prevRight, fade);
+      }
+    }
+    if (compensate || (smartPath.fade && smartPath.prev == 0))
+      compPos = (compPos + 1) & 7;
+    if (watchdogEnabled) {
+      for (int s=0; s<simdCnt; s++){
+        if (watchdog(leftOut[s]) | watchdog(rightOut[s])) {
+          for (int p=0; p<3; p++)
+            resetPath(p, s);
+          leftOut[s] = rightOut[s] = float_4::zero();
         }
       }
     }
@@ -184,6 +367,7 @@ struct ShapedVCA : VenomModule {
   json_t* dataToJson() override {
     json_t* rootJ = VenomModule::dataToJson();
     json_object_set_new(rootJ, "algo", json_integer(algo));
+    json_object_set_new(rootJ, "smartOver", json_boolean(smartOver));
     return rootJ;
   }
 
@@ -196,6 +380,8 @@ struct ShapedVCA : VenomModule {
       algo = json_boolean_value(val) ? 2 : 1;
     else
       algo = 2;
+    val = json_object_get(rootJ, "smartOver");
+    smartOver = val ? json_boolean_value(val) : false;
   }
 
 };
@@ -281,6 +467,7 @@ struct ShapedVCAWidget : VenomWidget {
         module->algo = val;
       }
     ));
+    menu->addChild(createBoolPtrMenuItem("Smart oversampling (only audio rate CV or clipping)", "", &module->smartOver));
 
     VenomWidget::appendContextMenu(menu);
   }
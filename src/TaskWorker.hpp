@@ -22,8 +22,11 @@ struct TaskWorker {
   }
 
   ~TaskWorker() {
-    workerIsRunning = false;
-    workerDoProcess = true;
+    {
+      std::lock_guard<std::mutex> lock(workerMutex);
+      workerIsRunning = false;
+      workerDoProcess = true;
+    }
     workerCondVar.notify_one();
     worker->join();
     workerContext = NULL;
@@ -33,17 +36,27 @@ struct TaskWorker {
   void processWorker() {
     contextSet(workerContext);
     while (true) {
-      std::unique_lock<std::mutex> lock(workerMutex);
-      workerCondVar.wait(lock, std::bind(&TaskWorker::workerDoProcess, this));
-      if (!workerIsRunning) return;
-      workerTask();
-      workerDoProcess = false;
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(workerMutex);
+        workerCondVar.wait(lock, std::bind(&TaskWorker::workerDoProcess, this));
+        if (!workerIsRunning) return;
+        // Take the task and clear the request before running it, so a request made while the
+        // task runs is queued for the next pass instead of overwriting or losing it.
+        // The lock is not held while the task runs, so work() never waits on a task.
+        task.swap(workerTask);
+        workerDoProcess = false;
+      }
+      task();
     }
   }
 
   void work(std::function<void()> task) {
-    workerTask = task;
-    workerDoProcess = true;
+    {
+      std::lock_guard<std::mutex> lock(workerMutex);
+      workerTask = task;
+      workerDoProcess = true;
+    }
     workerCondVar.notify_one();
   }
 };
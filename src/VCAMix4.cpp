@@ -42,6 +42,12 @@ struct VCAMix4 : MixBaseModule {
   int oversample = 4;
   OversampleFilter_4 outUpSample[4]{}, outDownSample[4]{}, cvVcaBandlimit[5][4]{}, inVcaBandlimit[5][4]{}, outVcaBandlimit[5][4];
   DCBlockFilter_4 dcBlockBeforeFilter[4]{}, dcBlockAfterFilter[4]{};
+  float dcBlockCoef = 0.001f;
+  float sampleRate = 48000.f;
+  // A channel VCA whose gain is exactly zero across a group is closed. Once closed long enough for the
+  // band limiting filter tails to decay, the filters are cleared and the VCA is skipped until it opens.
+  static const int closedHold = 64;
+  int closedCnt[4][4]{};
 
   VCAMix4() {
     venomConfig(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -73,10 +79,17 @@ struct VCAMix4 : MixBaseModule {
     for (int i=0; i<4; i++)
       configBypass(INPUTS+i, OUTPUTS+i);
     oversampleStages = 5;
+    watchdogAvailable = true;
+    setOversample();
+  }
+
+  void onSampleRateChange(const SampleRateChangeEvent& e) override {
+    sampleRate = e.sampleRate;
     setOversample();
   }
 
   void setOversample() override {
+    dcBlockCoef = DCBlockFilter_4::coefficient(sampleRate);
     for (int i=0; i<4; i++){
       outUpSample[i].setOversample(oversample, oversampleStages);
       outDownSample[i].setOversample(oversample, oversampleStages);
@@ -155,6 +168,26 @@ struct VCAMix4 : MixBaseModule {
         cv = inputs[CV_INPUTS+i].isConnected() ? (mode == 1 ? inputs[CV_INPUTS+i].getVoltageSum()/10.f : inputs[CV_INPUTS+i].getPolyVoltageSimd<simd::float_4>(c) / 10.f) : 1.0f;
         channel[i] = preOff[i] + (mode == 1 ? inputs[INPUTS+i].getVoltageSum() : inputs[INPUTS+i].getNormalPolyVoltageSimd<simd::float_4>(normal, c));
         int vcaOversample = vcaMode>=4 && inputs[CV_INPUTS+i].isConnected() && inputs[INPUTS+i].isConnected() ? 4 : 1;
+        float channelScale = (params[LEVEL_PARAMS+i].getValue()+offset)*scale;
+        bool zero = channelScale == 0.f || (inputs[CV_INPUTS+i].isConnected() && !simd::movemask((vcaMode <= 1 ? simd::clamp(cv, 0.f, 1.f) : cv) != 0.f));
+        int& closed = closedCnt[i][c/4];
+        if (!zero)
+          closed = 0;
+        else if (closed <= closedHold)
+          closed++;
+        if (closed == closedHold) {
+          cvVcaBandlimit[i][c/4].reset();
+          inVcaBandlimit[i][c/4].reset();
+          outVcaBandlimit[i][c/4].reset();
+        }
+        if (zero && (vcaOversample == 1 || closed >= closedHold)) {
+          channel[i] = 0.f;
+          vcaOversample = 0;
+        }
+        else if (!inputs[CV_INPUTS+i].isConnected()) {
+          channel[i] *= channelScale; // static gain
+          vcaOversample = 0;
+        }
         for (int s=0; s<vcaOversample; s++){
           if (vcaOversample > 1) {
             cv = cvVcaBandlimit[i][c/4].process(s ? 0.f : cv*vcaOversample);
@@ -164,11 +197,18 @@ struct VCAMix4 : MixBaseModule {
             cv = simd::clamp(cv, 0.f, 1.f);
           if (vcaMode == 1 || vcaMode == 3 || vcaMode == 5)
             cv = simd::sgn(cv)*simd::pow(simd::abs(cv), 4);
-          channel[i] *= (params[LEVEL_PARAMS+i].getValue()+offset)*scale*cv;
+          channel[i] *= channelScale*cv;
           if (vcaOversample > 1) {
             channel[i] = outVcaBandlimit[i][c/4].process(channel[i]);
           }
         }
+        // a patched channel output is removed from the mix, so its VCA filters are checked here
+        if (watchdogEnabled && vcaOversample > 1 && watchdog(channel[i])) {
+          cvVcaBandlimit[i][c/4].reset();
+          inVcaBandlimit[i][c/4].reset();
+          outVcaBandlimit[i][c/4].reset();
+          channel[i] = 0.f;
+        }
         channel[i] += postOff[i];
         outputs[OUTPUTS+i].setVoltageSimd(channel[i], c);
         if (exclude && outputs[OUTPUTS+i].isConnected())
@@ -304,7 +344,7 @@ struct VCAMix4 : MixBaseModule {
       int vcaOversample = vcaMode>=4 && inputs[MIX_CV_INPUT].isConnected() ? 4 : 1;
 
       if (dcBlock && dcBlock < 3)
-        out = dcBlockBeforeFilter[c/4].process(out);
+        out = dcBlockBeforeFilter[c/4].process(out, dcBlockCoef);
 
       if (clip == 4) // hard pre
         out = clamp(out, -10.f, 10.f);
@@ -355,10 +395,24 @@ struct VCAMix4 : MixBaseModule {
       }  
 
       if (dcBlock == 3 || (dcBlock == 2 && clip))
-        out = dcBlockAfterFilter[c/4].process(out);
+        out = dcBlockAfterFilter[c/4].process(out, dcBlockCoef);
       out *= fadeLevel[4]; // Mix fade factor
+      if (watchdogEnabled && watchdog(out)) {
+        outUpSample[c/4].reset();
+        outDownSample[c/4].reset();
+        for (int i=0; i<5; i++) {
+          cvVcaBandlimit[i][c/4].reset();
+          inVcaBandlimit[i][c/4].reset();
+          outVcaBandlimit[i][c/4].reset();
+        }
+        dcBlockBeforeFilter[c/4].reset();
+        dcBlockAfterFilter[c/4].reset();
+        out = simd::float_4::zero();
+      }
       outputs[MIX_OUTPUT].setVoltageSimd(out, c);
     }
+    if (watchdogEnabled)
+      watchdogFades();
     for (int i=0; i<4; i++)
       outputs[OUTPUTS+i].setChannels(inChannels[i]);
     outputs[MIX_OUTPUT].setChannels(channels);
@@ -51,6 +51,12 @@ struct VCAMix4Stereo : MixBaseModule {
                      outLeftVcaBandlimit[5][4]{}, outRightVcaBandlimit[5][4]{};
   DCBlockFilter_4 leftDcBlockBeforeFilter[4]{}, leftDcBlockAfterFilter[4]{}, 
                   rightDcBlockBeforeFilter[4]{}, rightDcBlockAfterFilter[4]{};
+  float dcBlockCoef = 0.001f;
+  float sampleRate = 48000.f;
+  // A channel VCA whose gain is exactly zero across a group is closed. Once closed long enough for the
+  // band limiting filter tails to decay, the filters are cleared and the VCA is skipped until it opens.
+  static const int closedHold = 64;
+  int closedCnt[4][4]{};
 
   VCAMix4Stereo() {
     venomConfig(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -91,10 +97,17 @@ struct VCAMix4Stereo : MixBaseModule {
       configBypass(inputs[RIGHT_INPUTS+i].isConnected() ? RIGHT_INPUTS+i : LEFT_INPUTS+i, RIGHT_OUTPUTS+i);
     }
     oversampleStages = 5;
+    watchdogAvailable = true;
+    setOversample();
+  }
+
+  void onSampleRateChange(const SampleRateChangeEvent& e) override {
+    sampleRate = e.sampleRate;
     setOversample();
   }
 
   void setOversample() override {
+    dcBlockCoef = DCBlockFilter_4::coefficient(sampleRate);
     for (int i=0; i<4; i++){
       leftUpSample[i].setOversample(oversample, oversampleStages);
       leftDownSample[i].setOversample(oversample, oversampleStages);
@@ -199,6 +212,28 @@ struct VCAMix4Stereo : MixBaseModule {
         }
         vcaOversample = vcaMode>=4 && inputs[CV_INPUTS+i].isConnected() && (inputs[LEFT_INPUTS+i].isConnected() || inputs[RIGHT_INPUTS+i].isConnected()) ? 4 : 1;
         channelScale = (params[LEVEL_PARAMS+i].getValue()+offset)*scale;
+        bool zero = channelScale == 0.f || (inputs[CV_INPUTS+i].isConnected() && !simd::movemask((vcaMode <= 1 ? simd::clamp(cv, 0.f, 1.f) : cv) != 0.f));
+        int& closed = closedCnt[i][c/4];
+        if (!zero)
+          closed = 0;
+        else if (closed <= closedHold)
+          closed++;
+        if (closed == closedHold) {
+          cvVcaBandlimit[i][c/4].reset();
+          inLeftVcaBandlimit[i][c/4].reset();
+          inRightVcaBandlimit[i][c/4].reset();
+          outLeftVcaBandlimit[i][c/4].reset();
+          outRightVcaBandlimit[i][c/4].reset();
+        }
+        if (zero && (vcaOversample == 1 || closed >= closedHold)) {
+          leftChannel[i] = rightChannel[i] = 0.f;
+          vcaOversample = 0;
+        }
+        else if (!inputs[CV_INPUTS+i].isConnected()) {
+          leftChannel[i] *= channelScale; // static gain
+          rightChannel[i] *= channelScale;
+          vcaOversample = 0;
+        }
         for (int s=0; s<vcaOversample; s++) {
           if (vcaOversample > 1) {
             cv = cvVcaBandlimit[i][c/4].process(s ? 0.f : cv*vcaOversample);
@@ -216,6 +251,15 @@ struct VCAMix4Stereo : MixBaseModule {
             rightChannel[i] = outRightVcaBandlimit[i][c/4].process(rightChannel[i]);
           }
         }
+        // a patched channel output is removed from the mix, so its VCA filters are checked here
+        if (watchdogEnabled && vcaOversample > 1 && (watchdog(leftChannel[i]) | watchdog(rightChannel[i]))) {
+          cvVcaBandlimit[i][c/4].reset();
+          inLeftVcaBandlimit[i][c/4].reset();
+          inRightVcaBandlimit[i][c/4].reset();
+          outLeftVcaBandlimit[i][c/4].reset();
+          outRightVcaBandlimit[i][c/4].reset();
+          leftChannel[i] = rightChannel[i] = 0.f;
+        }
         leftChannel[i] += postOff[i];
         outputs[LEFT_OUTPUTS+i].setVoltageSimd(leftChannel[i], c);
         if (exclude && outputs[LEFT_OUTPUTS+i].isConnected())
@@ -417,8 +461,8 @@ struct VCAMix4Stereo : MixBaseModule {
       vcaOversample = vcaMode>=4 && inputs[MIX_CV_INPUT].isConnected() ? 4 : 1;
 
       if (dcBlock && dcBlock < 3) {
-        leftOut = leftDcBlockBeforeFilter[c/4].process(leftOut);
-        rightOut = rightDcBlockBeforeFilter[c/4].process(rightOut);
+        leftOut = leftDcBlockBeforeFilter[c/4].process(leftOut, dcBlockCoef);
+        rightOut = rightDcBlockBeforeFilter[c/4].process(rightOut, dcBlockCoef);
       }
 
       if (clip == 4) { // hard pre
@@ -497,15 +541,35 @@ struct VCAMix4Stereo : MixBaseModule {
       }  
 
       if (dcBlock == 3 || (dcBlock == 2 && clip)) {
-        leftOut = leftDcBlockAfterFilter[c/4].process(leftOut);
-        rightOut = rightDcBlockAfterFilter[c/4].process(rightOut);
+        leftOut = leftDcBlockAfterFilter[c/4].process(leftOut, dcBlockCoef);
+        rightOut = rightDcBlockAfterFilter[c/4].process(rightOut, dcBlockCoef);
       }
 
       leftOut  *= fadeLevel[4]; // Mix fade factor
       rightOut *= fadeLevel[4]; // Mix fade factor
+      if (watchdogEnabled && (watchdog(leftOut) | watchdog(rightOut))) {
+        leftUpSample[c/4].reset();
+        leftDownSample[c/4].reset();
+        rightUpSample[c/4].reset();
+        rightDownSample[c/4].reset();
+        for (int i=0; i<5; i++) {
+          cvVcaBandlimit[i][c/4].reset();
+          inLeftVcaBandlimit[i][c/4].reset();
+          inRightVcaBandlimit[i][c/4].reset();
+          outLeftVcaBandlimit[i][c/4].reset();
+          outRightVcaBandlimit[i][c/4].reset();
+        }
+        leftDcBlockBeforeFilter[c/4].reset();
+        rightDcBlockBeforeFilter[c/4].reset();
+        leftDcBlockAfterFilter[c/4].reset();
+        rightDcBlockAfterFilter[c/4].reset();
+        leftOut = rightOut = simd::float_4::zero();
+      }
       outputs[LEFT_MIX_OUTPUT].setVoltageSimd(leftOut, c);
       outputs[RIGHT_MIX_OUTPUT].setVoltageSimd(rightOut, c);
     }
+    if (watchdogEnabled)
+      watchdogFades();
     for (int i=0; i<4; i++){
       outputs[LEFT_OUTPUTS+i].setChannels(inChannels[i]);
       outputs[RIGHT_OUTPUTS+i].setChannels(inChannels[i]);
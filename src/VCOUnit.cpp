@@ -5,6 +5,9 @@
 #include "Filter.hpp"
 #include "math.hpp"
 #include <float.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 struct VCOUnit : VenomModule {
  
@@ -72,17 +75,35 @@ struct VCOUnit : VenomModule {
   bool softSync = false;
   bool alternate = false;
   bool disableDPW = false;
-  bool aliasSuppress = false;
+  bool polyBlep = false;
+  int antiAlias = 0; // 0 = off, 1 = DPW, 2 = polyBLEP/polyBLAMP
   using float_4 = simd::float_4;
   int oversample = -1;
   std::vector<int> oversampleValues = {1,2,4,8,16,32};
   OversampleFilter_4 expUpSample[4]{}, linUpSample[4]{}, revUpSample[4]{}, syncUpSample[4]{},
                      shapeUpSample[4]{}, phaseUpSample[4]{}, offsetUpSample[4]{}, levelUpSample[4]{},
                      outDownSample[4]{};
-  float_4 phasor[4]{}, phasorDir[4]{1.f, 1.f, 1.f, 1.f};
+  simd::int32_4 phase[4]{}; // 32 bit fixed point phase accumulator
+  float_4 phasor[4]{}, phasorDir[4]{1.f, 1.f, 1.f, 1.f}; // phase converted to [0, 1000) for shape math
   DCBlockFilter_4 linDcBlockFilter[4]{}, outDcBlockFilter[4]{};
+  float dcBlockCoef = 0.001f;
+  float sampleRate = 48000.f; // engine rate from the last sample rate event, so nothing here reads APP
   bool linDCCouple = false;
   dsp::SchmittTrigger syncTrig[16], revTrig[16];
+  bool subSampleSync = false;
+  float syncPrev[16]{}, syncFrac[16]{};
+  int syncStep[16]{}; // oversample step of a pending sub-sample sync + 1, 0 = none pending
+  SyncBLEP_4 syncBlep[4]{};
+  // Block pitch conversion: when oversampling, exp2 is computed once per sample from the
+  // V/Oct and exponential FM inputs, and the frequency is interpolated across the sub-samples
+  bool pitchBlockInterp = false;
+  bool pitchBlockReset = true;
+  float_4 pitchPrev[4]{}, pitchNext[4]{};
+  // Automatic input oversampling: connected inputs that only carry slow CV are held across the
+  // sub-samples instead of being run through the upsample filters
+  bool autoOver = false;
+  bool autoSlow[INPUTS_LEN]{};
+  AudioRateDetector overDetector[INPUTS_LEN]{};
   float modeFreq[3] = {dsp::FREQ_C4, 2.f, 100.f}, biasFreq = 0.02f;
   int currentMode = -1;
   int mode = 0;
@@ -92,6 +113,44 @@ struct VCOUnit : VenomModule {
   bool gated = false;
   float_4 onceActive[4]{};
   int modeDefaultOver[3] = {2, 0, 2};
+  // Control rate engine for the low frequency modes: the waveform is computed every lfoDivision
+  // samples without oversampling, and the output ramps along the slope predicted from the last
+  // two computed values. After a jump the next compute runs one sample later to measure the slope.
+  static const int lfoDivision = 16;
+  bool lfoControlRate = false;
+  bool lfoRate = false, lfoJump = false, lfoResume = false;
+  int lfoSamples = 0, lfoNext = lfoDivision, lfoChannels = 1, lfoOnceMask = 0;
+  float_4 lfoOut[4]{}, lfoStep[4]{}, lfoPrev[4]{};
+  // Band-limited wavetable mode for static shapes in the audio frequency modes. Each wave and
+  // shape setting is rendered into octave spaced mip-map levels on a worker thread, and read
+  // with linear interpolation without oversampling. Level n holds harmonics up to 1024 >> n.
+  // Tables pass between the threads only by atomic pointer exchange, so the audio thread never
+  // waits, and it keeps playing its current table until the rebuilt one is handed over.
+  struct Wavetable {
+    static const int size = 2048;
+    static const int levels = 11;
+    float table[levels][size + 1];
+    int wave = -1, shapeMode = -1;
+    float shape = 0.f;
+  };
+  bool wavetableMode = false;
+  bool wavetableOn = false, wavetableActive = false;
+  Wavetable* wavetables = NULL; // pair of tables, allocated when the mode is first enabled
+  Wavetable* wavetable = NULL; // table in use by the audio thread
+  std::atomic<Wavetable*> wavetableFresh{NULL}; // newly built table not yet in use
+  std::atomic<Wavetable*> wavetableFree{NULL}; // table released by the audio thread for reuse
+  std::atomic<bool> wavetableRunning{false};
+  std::thread* wavetableThread = NULL;
+  // Internal unison: up to 16 detuned voices driven by the same inputs are summed to a mono or
+  // stereo output before DC blocking and downsampling, so one filter serves every voice.
+  int unison = 1; // 1 = off
+  int unisonSpread = 2;
+  std::vector<float> unisonSpreadValues = {5.f, 10.f, 20.f, 35.f, 50.f, 100.f}; // total spread in cents
+  bool unisonRandomPhase = true;
+  bool unisonStereo = false;
+  bool unisonDirty = true;
+  float_4 unisonVOct[4]{}, unisonGainL[4]{}, unisonGainR[4]{};
+  int32_t unisonPhase[16]{}; // random starting phases, drawn outside process()
   
   struct ShapeQuantity : ParamQuantity {
     float getDisplayValue() override {
@@ -186,18 +245,24 @@ struct VCOUnit : VenomModule {
     configLight(VCA_LIGHT, "Bipolar VCA indicator");
     
     oversampleStages = 5;
+    watchdogAvailable = true;
   }
 
-  float_4 sinSimd_1000(float_4 t) {
-    t = simd::ifelse(t > 500.f, 1000.f - t, t) * 0.002f - 0.5f;
-    float_4 t2 = t * t;
-    return -(((-0.540347 * t2 + 2.53566) * t2 - 5.16651) * t2 + 3.14159) * t;
+  ~VCOUnit() {
+    if (wavetableThread) {
+      wavetableRunning = false;
+      wavetableThread->join();
+      delete wavetableThread;
+    }
+    if (wavetables)
+      delete[] wavetables;
   }
-  
+
   void setMode(bool aliasSuppressOnly = false) {
     currentMode = static_cast<int>(params[MODE_PARAM].getValue());
     mode = currentMode>5 ? 1 : currentMode>2 ? 0 : currentMode;
-    aliasSuppress = !(mode || disableDPW);
+    // DPW is unstable at low frequencies so it is limited to the audio modes, but polyBLEP works in any mode
+    antiAlias = polyBlep ? 2 : (mode || disableDPW) ? 0 : 1;
     if (aliasSuppressOnly)
       return;
     if (!paramExtensions[OVER_PARAM].locked)
@@ -260,7 +325,28 @@ struct VCOUnit : VenomModule {
     lights[VCOUnit::VCA_LIGHT].setBrightness(val);
   }
   
+  void onSampleRateChange(const SampleRateChangeEvent& e) override {
+    sampleRate = e.sampleRate;
+    setOversample();
+  }
+
+  // Upsampling filter of an input for group s, or NULL if the input has none
+  OversampleFilter_4* inputUpSample(int id, int s) {
+    switch (id) {
+      case EXP_INPUT:    return &expUpSample[s];
+      case LIN_INPUT:    return &linUpSample[s];
+      case SYNC_INPUT:   return &syncUpSample[s];
+      case REV_INPUT:    return &revUpSample[s];
+      case SHAPE_INPUT:  return &shapeUpSample[s];
+      case PHASE_INPUT:  return &phaseUpSample[s];
+      case OFFSET_INPUT: return &offsetUpSample[s];
+      case LEVEL_INPUT:  return &levelUpSample[s];
+      default:           return NULL;
+    }
+  }
+
   void setOversample() override {
+    dcBlockCoef = DCBlockFilter_4::coefficient(sampleRate, std::max(oversample, 1));
     for (int i=0; i<4; i++){
       expUpSample[i].setOversample(oversample, oversampleStages);
       linUpSample[i].setOversample(oversample, oversampleStages);
@@ -274,6 +360,52 @@ struct VCOUnit : VenomModule {
     }
   }
   
+  void resetSimdState(int s) {
+    expUpSample[s].reset();
+    linUpSample[s].reset();
+    revUpSample[s].reset();
+    syncUpSample[s].reset();
+    syncBlep[s].reset();
+    shapeUpSample[s].reset();
+    phaseUpSample[s].reset();
+    offsetUpSample[s].reset();
+    levelUpSample[s].reset();
+    outDownSample[s].reset();
+    linDcBlockFilter[s].reset();
+    outDcBlockFilter[s].reset();
+    phase[s] = simd::int32_4::zero();
+    phasor[s] = float_4::zero();
+  }
+
+  // Called from the menu and patch load whenever a unison setting changes. Any random phases are
+  // drawn here, so process() only copies them when it applies the new settings.
+  void unisonChanged() {
+    if (unison>1 && unisonRandomPhase) {
+      for (int v=0; v<unison; v++)
+        unisonPhase[v] = static_cast<int32_t>(random::u32());
+    }
+    unisonDirty = true;
+  }
+
+  // Detune and pan the unison voices evenly across the spread, and optionally apply the random phases
+  void setUnison() {
+    unisonDirty = false;
+    float spread = unisonSpreadValues[unisonSpread] / 1200.f;
+    float norm = 1.f / std::sqrt(static_cast<float>(unison));
+    for (int v=0; v<16; v++) {
+      int s = v/4, i = v%4;
+      bool on = v < unison;
+      float pos = unison>1 ? static_cast<float>(v) / (unison-1) : 0.5f;
+      unisonVOct[s][i] = on ? (pos - 0.5f) * spread : 0.f;
+      unisonGainL[s][i] = on ? norm * (unisonStereo ? std::cos(pos * M_PI_2) : 1.f) : 0.f;
+      unisonGainR[s][i] = on && unisonStereo ? norm * std::sin(pos * M_PI_2) : 0.f;
+      if (on && unison>1 && unisonRandomPhase)
+        phase[s][i] = unisonPhase[v];
+    }
+    for (int s=0; s<4; s++)
+      phasor[s] = phase32ToPhasor(phase[s]);
+  }
+
   void loadPhases(float_4* phases, float_4 phasor, float_4 delta){
     phases[0] = phasor - 2 * delta + ifelse(phasor < 2 * delta, 1.f, ifelse(phasor > (1+2*delta),-1.f,0.f));
     phases[1] = phasor - delta + ifelse(phasor < delta, 1.f, ifelse(phasor > (1+delta),-1.f,0.f));
@@ -300,6 +432,293 @@ struct VCOUnit : VenomModule {
     return ((buffer[0] - buffer[1] - buffer[1] + buffer[2])*denInv + 1.f) / 2.f;
   }
 
+  // Lanes whose new value missed the predicted ramp by more than half of the last period's movement
+  static float_4 lfoMiss(float_4 val, float_4 out, float_4 step, bool resume) {
+    if (resume)
+      return float_4::zero();
+    return simd::fabs(val - out - step) > simd::fmax(1e-3f, simd::fabs(step) * (0.5f * lfoDivision));
+  }
+
+  // Jumps snapped lanes to val, and ramps the rest toward the value predicted one sample before the next compute
+  static void lfoRamp(float_4 val, float_4& out, float_4& step, float_4& prev, float_4 snap, int elapsed) {
+    float_4 slope = (val - prev) / static_cast<float>(elapsed);
+    float_4 newStep = (val + slope * static_cast<float>(lfoDivision - 1) - out) / static_cast<float>(lfoDivision);
+    step = simd::ifelse(snap, float_4::zero(), newStep);
+    out = simd::ifelse(snap, val, out + newStep);
+    prev = val;
+  }
+
+  // True if a sync or reverse trigger would change state, so the control rate engine
+  // must compute now to keep triggers sample accurate
+  bool lfoTrigChange(int id, dsp::SchmittTrigger* trig) {
+    if (!inputs[id].isConnected())
+      return false;
+    for (int c=0; c<lfoChannels; c++) {
+      float v = inputs[id].getPolyVoltage(c);
+      if (trig[c].isHigh() ? v <= syncLo : v >= syncHi)
+        return true;
+    }
+    return false;
+  }
+
+  // Waveform for a wave and shape mode at 32 bit phase ph shifted by a phasor offset.
+  // flip is the unclamped pulse width flip point used by the PWM square modes.
+  // aa selects the anti-alias method: 0 = off, 1 = DPW, 2 = polyBLEP/polyBLAMP
+  float_4 shapeWave(int waveNum, int shapeMode, int aa, simd::int32_4 ph, float_4 offset, float_4 shape, float_4 flip,
+                    float_4 delta, float_4 lowFreq, float_4 denInv) {
+    float_4 out{}, wavePhasor{}, sawPhasor{}, offsetSawPhasor{}, shapeSign{}, blamp{};
+    float_4 phases[3]{};
+    switch (waveNum) {
+      case 0: // SIN
+        wavePhasor = phase32Phasor(ph, offset - 250.f);
+        wavePhasor = sinSimd_1000(wavePhasor);
+        switch (shapeMode) {
+          case 0:  // exp/log
+            out = crossfade(wavePhasor, ifelse(shape>0.f, 11.f*wavePhasor/(10.f*simd::abs(wavePhasor)+1.f), simd::sgn(wavePhasor)*simd::pow(wavePhasor,4)), ifelse(shape>0.f, shape, -shape))*5.f;
+            break;
+          case 1:  // J curve
+            out = (normSigmoid((wavePhasor+1.f)/2.f, -shape*0.9f)*2.f-1.f) * 5.f;
+            break;
+          case 2: // S curve
+            out = normSigmoid(wavePhasor, -shape*0.9f) * 5.f;
+            break;
+          case 3: // Rectify
+          case 4: // Normalized Rectify
+            shape = -shape;
+            shapeSign = simd::sgn(shape);
+            out = simd::ifelse(shapeSign==0, wavePhasor, -(shapeSign*simd::abs(-wavePhasor+shapeSign-shape)-shapeSign+shape));
+            if (shapeMode==4) // Normalized rectify
+              out = -((1+simd::abs(shape))*-out-shape);
+            out *= 5.f;
+            break;
+          default: // 5 morph square <--> sine <--> saw
+            out = wavePhasor * 5.f * (1.f - simd::abs(shape)); // sine component
+            // square and saw components
+            wavePhasor = phase32ToPhasor(ph) + offset;
+            wavePhasor = phase32Phasor(ph, offset + simd::ifelse(wavePhasor<0.f, 0.f, 500.f));
+            out += simd::ifelse( shape<=0.f,
+                                 simd::ifelse(wavePhasor<500.f, 5.f, -5.f) * shape, // square component
+                                 (wavePhasor*0.01f - 5.f) * shape // saw component
+                               );
+        } // end sine shape switch
+        break;
+      case 1: // TRI
+        wavePhasor = phase32Phasor(ph, offset + 250.f);
+        if (shapeMode<=2) shape = simd::ifelse(wavePhasor<500.f, shape, -shape);
+        if (aa==2 && shapeMode<=2) {
+          // the slope changes by +4 at the trough and -4 at the peak
+          float_4 t = wavePhasor * 0.001f, dt = simd::fmax(simd::fabs(delta), 1e-6f);
+          float_4 u = t + simd::ifelse(t < 0.5f, 0.5f, -0.5f);
+          blamp = (polyBlamp(t, dt) - polyBlamp(u, dt)) * 4.f;
+        }
+        wavePhasor = simd::ifelse(wavePhasor<500.f, wavePhasor*.002f, (1000.f-wavePhasor)*.002f) + blamp;
+        switch (shapeMode) {
+          case 0:  // exp/log
+            out = crossfade(wavePhasor, ifelse(shape>0.f, 11.f*wavePhasor/(10.f*simd::abs(wavePhasor)+1.f), simd::sgn(wavePhasor)*simd::pow(wavePhasor,4)), ifelse(shape>0.f, shape, -shape))*10.f-5.f;
+            break;
+          case 1:  // J curve
+            out = normSigmoid(wavePhasor, -shape*0.8) * 10.f - 5.f;
+            break;
+          case 2: // S curve
+            out = normSigmoid(wavePhasor*2.f-1.f, -shape*0.8) * 5.f;
+            break;
+          case 3: // Rectify
+          case 4: // Normalized Rectify
+            shape = -shape;
+            shapeSign = simd::sgn(shape);
+            out = wavePhasor*2.f-1.f;
+            out = simd::ifelse(shapeSign==0, out, -(shapeSign*simd::abs(-out+shapeSign-shape)-shapeSign+shape));
+            if (shapeMode==4) // Normalized Rectify
+              out = -((1+simd::abs(shape))*-out-shape);
+            out *= 5.f;
+            break;
+          default: // 5 morph sine <--> triangle <--> square
+            out = (wavePhasor*10.f - 5.f) * (1.f - simd::abs(shape)); // triangle component
+            // sine and square components
+            wavePhasor = phase32Phasor(ph, offset - simd::ifelse(shape<=0.f, 250.f, 0.f));
+            out += simd::ifelse( shape<=0.f,
+                                 sinSimd_1000(wavePhasor)*5.f * -shape, // sine component
+                                 simd::ifelse(wavePhasor<500.f, 5.f, -5.f) * shape // square component
+                               );
+        } // end triangle shape switch
+        break;
+      case 2: // SQR
+        wavePhasor = phase32Phasor(ph, offset);
+        if (shapeMode==2) { // morph tri <--> sqr <--> saw
+          out = simd::ifelse(wavePhasor<500.f, 5.f, -5.f) * (1.f - simd::abs(shape)); // square component
+          // triangle and saw components
+          wavePhasor = phase32Phasor(ph, offset + simd::ifelse(shape<=0.f, 250.f, 500.f));
+          out += simd::ifelse( shape<=0.f, 
+                               (simd::ifelse(wavePhasor<500.f, wavePhasor, (1000.f-wavePhasor))*.02f - 5.f) * -shape, // triangle component
+                               (wavePhasor*0.01f - 5.f) * shape // saw component
+                             );
+        } else { // PWM
+          if (!shapeMode) flip = clamp( flip, 30.f, 970.f );
+          out = ifelse(wavePhasor<flip, 5.f, -5.f);
+          if (aa==1) {
+            loadPhases(phases, wavePhasor * 0.001f, delta);
+            sawPhasor = aliasSuppressedSaw(phases, denInv);
+            offsetSawPhasor = aliasSuppressedOffsetSaw(phases, 1.f - flip*0.001f, denInv);
+            out = ifelse(lowFreq, out, (offsetSawPhasor - sawPhasor + flip*0.001f - 0.5f) * 10.f);
+          }
+          if (aa==2) { // rising step at phase 0, falling step at the pulse width
+            float_4 t = wavePhasor * 0.001f, dt = simd::fmax(simd::fabs(delta), 1e-6f);
+            float_4 u = t - clamp(flip * 0.001f, 0.f, 1.f);
+            u += simd::ifelse(u < 0.f, 1.f, 0.f);
+            out += (polyBlep(t, dt) - polyBlep(u, dt)) * 10.f;
+          }
+        }
+        break;
+      default: // 3 SAW
+        wavePhasor = phase32Phasor(ph, offset);
+        wavePhasor *= 0.001f;
+        if (aa==1 && shapeMode < 3) {
+          loadPhases(phases, wavePhasor, delta);
+          wavePhasor = ifelse(lowFreq, wavePhasor, aliasSuppressedSaw(phases, denInv));
+        }
+        if (aa==2 && shapeMode < 3) // falling step at phase 0
+          wavePhasor -= polyBlep(wavePhasor, simd::fmax(simd::fabs(delta), 1e-6f));
+        switch (shapeMode) {
+          case 0:  // exp/log
+            out = crossfade(wavePhasor, ifelse(shape>0.f, 11.f*wavePhasor/(10.f*simd::abs(wavePhasor)+1.f), simd::sgn(wavePhasor)*simd::pow(wavePhasor,4)), ifelse(shape>0.f, shape, -shape))*10.f-5.f;
+            break;
+          case 1:  // J Curve
+            out = normSigmoid(wavePhasor, -shape*0.90) * 10.f - 5.f;
+            break;
+          case 2: // S Curve
+            out = normSigmoid(wavePhasor*2.f-1.f, -shape*0.85) * 5.f;
+            break;
+          case 3: // Rectify
+          case 4: // Normalized Rectify
+            shape = -shape;
+            shapeSign = simd::sgn(shape);
+            out = wavePhasor*2.f-1.f;
+            out = simd::ifelse(shapeSign==0, out, -(shapeSign*simd::abs(-out+shapeSign-shape)-shapeSign+shape));
+            if (shapeMode==4) // Normalized Rectify
+              out = -((1+simd::abs(shape))*-out-shape);
+            out *= 5.f;
+            break;
+          default: // 5 morph square <--> saw <--> even
+            out = (wavePhasor*10.f - 5.f) * simd::ifelse(shape<0.f, 1.f + shape, 1.f); // saw component
+            // square component
+            wavePhasor = phase32Phasor(ph, offset + simd::ifelse(shape<=0.f, 500.f, 0.f));
+            out += simd::ifelse(wavePhasor<500.f, 5.f, -5.f) * simd::abs(shape) * simd::ifelse(shape<0.f, 1.f, 0.5f);
+            // sine component
+            wavePhasor = phase32Phasor(ph, offset);
+            out += simd::ifelse(shape<0.f, 0.f, sinSimd_1000(wavePhasor) * 3.175 * shape);
+        } // end saw shape switch
+    } // end wave switch
+    return out;
+  }
+
+  // Runs on the worker thread, only writes a table the audio thread does not hold.
+  // The wave and shape settings to build are already stored in the table.
+  void buildWavetable(Wavetable& t) {
+    const int renderSize = Wavetable::size * 4;
+    int waveNum = t.wave, shapeMode = t.shapeMode;
+    float shapeParam = t.shape;
+    std::vector<float> renderMem(renderSize + 4), specMem(renderSize + 4), tableSpecMem(Wavetable::size + 4), tableMem(Wavetable::size + 4);
+    float* render = dsp::alignPtr(renderMem.data());
+    float* spec = dsp::alignPtr(specMem.data());
+    float* tableSpec = dsp::alignPtr(tableSpecMem.data());
+    float* table = dsp::alignPtr(tableMem.data());
+    float_4 shape = clamp(shapeParam, -1.f, 1.f), flip = (shapeParam + 1.f) * 500.f;
+    for (int i=0; i<renderSize; i+=4) {
+      float_4 p = float_4(i, i+1, i+2, i+3) * (1000.f / renderSize);
+      shapeWave(waveNum, shapeMode, 0, phasorToPhase32(p), float_4::zero(), shape, flip, float_4::zero(), float_4::zero(), float_4::zero()).store(&render[i]);
+    }
+    dsp::RealFFT renderFFT(renderSize), tableFFT(Wavetable::size);
+    renderFFT.rfft(render, spec);
+    // Truncate the render spectrum to each level, and scale for the smaller inverse transform
+    for (int l=0; l<Wavetable::levels; l++) {
+      int maxHarm = (Wavetable::size / 2) >> l;
+      tableSpec[0] = spec[0];
+      tableSpec[1] = 0.f;
+      for (int k=1; k<Wavetable::size/2; k++) {
+        tableSpec[2*k] = k <= maxHarm ? spec[2*k] : 0.f;
+        tableSpec[2*k+1] = k <= maxHarm ? spec[2*k+1] : 0.f;
+      }
+      tableFFT.irfft(tableSpec, table);
+      for (int i=0; i<Wavetable::size; i++)
+        t.table[l][i] = table[i] / renderSize;
+      t.table[l][Wavetable::size] = t.table[l][0];
+    }
+  }
+
+  // Worker thread loop. Polls the settings, and rebuilds whenever they differ from the last
+  // table built. Each finished table is offered to the audio thread, and the table it gives
+  // back, or an offered table it never took, becomes the next one to build into.
+  void wavetableWorker() {
+    Wavetable* spare = &wavetables[0];
+    int builtWave = -1, builtMode = -1;
+    float builtShape = 0.f;
+    while (wavetableRunning) {
+      if (wavetableMode && mode==0 && !inputs[SHAPE_INPUT].isConnected()) {
+        int waveNum = static_cast<int>(params[WAVE_PARAM].getValue());
+        int shapeMode = static_cast<int>(params[SHAPE_MODE_PARAM].getValue());
+        float shapeParam = params[SHAPE_PARAM].getValue();
+        if (!spare)
+          spare = wavetableFree.exchange(NULL);
+        if (spare && (waveNum != builtWave || shapeMode != builtMode || shapeParam != builtShape)) {
+          spare->wave = builtWave = waveNum;
+          spare->shapeMode = builtMode = shapeMode;
+          spare->shape = builtShape = shapeParam;
+          buildWavetable(*spare);
+          spare = wavetableFresh.exchange(spare);
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+
+  // The tables and worker thread are only allocated from the UI or patch load, never from the
+  // audio thread, and are kept once allocated
+  void setWavetableMode(bool val) {
+    if (val && !wavetables) {
+      wavetables = new Wavetable[2];
+      wavetableFree = &wavetables[1];
+      wavetableRunning = true;
+      wavetableThread = new std::thread(&VCOUnit::wavetableWorker, this);
+    }
+    wavetableMode = val;
+  }
+
+  // Takes a newly built table if one is ready, and releases the replaced one to the worker.
+  // The table in use keeps playing while a new one is built, even if it no longer matches the
+  // settings, and the shape is computed with oversampling only until the first table is ready.
+  void updateWavetable() {
+    wavetableOn = wavetableMode && mode==0 && !inputs[SHAPE_INPUT].isConnected();
+    wavetableActive = false;
+    if (!wavetableOn)
+      return;
+    if (wavetableFresh.load(std::memory_order_relaxed)) {
+      // only this thread takes the fresh table, so the exchange cannot come back empty
+      Wavetable* fresh = wavetableFresh.exchange(NULL);
+      if (wavetable)
+        wavetableFree = wavetable;
+      wavetable = fresh;
+    }
+    wavetableActive = wavetable != NULL;
+  }
+
+  float_4 wavetableOut(float_4 pos, float_4 freq, float sampleTime) {
+    Wavetable& t = *wavetable;
+    // Crossfade between the two levels above the exact band limit, so the timbre changes smoothly
+    // with pitch. Both levels have every harmonic below Nyquist, and the fade is continuous because
+    // the upper level is fully reached as the lower one would start to alias.
+    float_4 level = clamp(simd::log2(simd::fabs(freq) * (Wavetable::size * sampleTime)) + 1.f, 0.f, Wavetable::levels - 1.f);
+    pos *= Wavetable::size / 1000.f;
+    simd::int32_4 i = simd::int32_4(pos), l = simd::int32_4(level);
+    float_4 frac = pos - float_4(i), fade = level - float_4(l), y0, y1;
+    for (int j=0; j<4; j++) {
+      const float* lo = t.table[l[j]];
+      const float* hi = t.table[std::min(l[j] + 1, Wavetable::levels - 1)];
+      y0[j] = lo[i[j]] + (hi[i[j]] - lo[i[j]]) * fade[j];
+      y1[j] = lo[i[j]+1] + (hi[i[j]+1] - lo[i[j]+1]) * fade[j];
+    }
+    return y0 + (y1 - y0) * frac;
+  }
+
   void process(const ProcessArgs& args) override {
     VenomModule::process(args);
 
@@ -310,8 +729,39 @@ struct VCOUnit : VenomModule {
       setWave();
     }
 
-    if (oversample != oversampleValues[params[OVER_PARAM].getValue()]) {
-      oversample = oversampleValues[params[OVER_PARAM].getValue()];
+    if (lfoRate != (lfoControlRate && mode==1)) {
+      lfoRate = !lfoRate;
+      lfoJump = true;
+    }
+    int lfoElapsed = 1;
+    bool lfoSnap = false;
+    if (lfoRate) {
+      lfoSamples++;
+      if (!lfoJump && lfoSamples < lfoNext && !lfoTrigChange(SYNC_INPUT, syncTrig) && !lfoTrigChange(REV_INPUT, revTrig)) {
+        for (int s=0, c=0; c<lfoChannels; s++, c+=4) {
+          lfoOut[s] += lfoStep[s];
+          if (watchdogEnabled && (watchdog(lfoOut[s]) | watchdog(phasor[s]))) {
+            resetSimdState(s);
+            lfoOut[s] = lfoStep[s] = lfoPrev[s] = float_4::zero();
+          }
+          outputs[OUTPUT].setVoltageSimd(lfoOut[s], c);
+        }
+        return;
+      }
+      lfoElapsed = lfoJump ? 1 : lfoSamples;
+      // a compute forced early by a trigger jumps to the new value rather than ramping
+      lfoSnap = lfoJump || lfoSamples < lfoNext;
+      lfoSamples = 0;
+    }
+
+    if (unisonDirty)
+      setUnison();
+    bool unisonOn = unison > 1;
+    int shapeMode = static_cast<int>(params[SHAPE_MODE_PARAM].getValue());
+    updateWavetable();
+    int over = (lfoRate || wavetableActive) ? 1 : oversampleValues[params[OVER_PARAM].getValue()];
+    if (oversample != over) {
+      oversample = over;
       setOversample();
     }
     // get channel count
@@ -323,12 +773,15 @@ struct VCOUnit : VenomModule {
           channels = c;
       }
     }
+    if (unisonOn)
+      channels = unison;
     int simdCnt = (channels+3)/4;
     
     float_4 expIn{}, linIn{}, expDepthIn[4]{}, linDepthIn[4]{}, vOctIn[4]{}, revIn{}, syncIn{}, freq[4]{},
-            shapeIn{}, phaseIn{}, offsetIn{}, levelIn{}, out[4]{}, wavePhasor{}, sawPhasor{}, offsetSawPhasor{};
+            shapeIn{}, phaseIn{}, offsetIn{}, levelIn{}, out[4]{}, unisonOut{};
     float vOctParm = mode<2 ? params[FREQ_PARAM].getValue() + params[OCTAVE_PARAM].getValue() : params[FREQ_PARAM].getValue();
-    float k =  1000.f * args.sampleTime / oversample;
+    float k =  1000.f * args.sampleTime * lfoElapsed / oversample;
+    float dcCoef = dcBlockCoef * lfoElapsed;
     float_4 basePhaseDelta{}, lowFreq{}, denInv{};
     
     if (alternate != (mode==2)) {
@@ -355,12 +808,35 @@ struct VCOUnit : VenomModule {
       softSync = !softSync;
     }
     
-    int shapeMode = static_cast<int>(params[SHAPE_MODE_PARAM].getValue());
     bool procOver[INPUTS_LEN]{};
     for (int i=0; i<INPUTS_LEN; i++)
       procOver[i] = oversample>1 && inputs[i].isConnected() && !disableOver[i];
+    bool pitchBlock = pitchBlockInterp && oversample>1 && !alternate;
+    if (pitchBlock)
+      procOver[EXP_INPUT] = false;
+    float pitchStep = 1.f / oversample;
+    bool holdOver[INPUTS_LEN]{};
+    for (int i=0; i<INPUTS_LEN; i++) {
+      bool slow = false;
+      if (autoOver && procOver[i])
+        slow = !overDetector[i].process(inputs[i], args.sampleRate);
+      else
+        overDetector[i].reset(); // starts fresh, rather than from stale state, when the input is next monitored
+      // an input that returns to oversampling resumes from its held value rather than stale state
+      if (autoSlow[i] && !slow) {
+        for (int s=0, c=0; s<simdCnt; s++, c+=4) {
+          if (OversampleFilter_4* f = inputUpSample(i, s))
+            f->prime(inputs[i].getPolyVoltageSimd<float_4>(c));
+        }
+      }
+      autoSlow[i] = slow;
+      if (autoSlow[i])
+        procOver[i] = false;
+      holdOver[i] = disableOver[i] || autoSlow[i];
+    }
     // main loops
     for (int o=0; o<oversample; o++){
+      float_4 unisonL{}, unisonR{};
       for (int s=0, c=0; s<simdCnt; s++, c+=4){
         float_4 level{};
         // Main Phasor
@@ -379,7 +855,7 @@ struct VCOUnit : VenomModule {
         }
         if (!alternate) {
           if (s==0 || inputs[EXP_INPUT].isPolyphonic()) {
-            expIn = (o && !disableOver[EXP_INPUT]) ? float_4::zero() : inputs[EXP_INPUT].getPolyVoltageSimd<float_4>(c);
+            expIn = (o && !holdOver[EXP_INPUT]) ? float_4::zero() : inputs[EXP_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[EXP_INPUT]){
               if (o==0) expIn *= oversample;
               expIn = expUpSample[s].process(expIn);
@@ -387,18 +863,18 @@ struct VCOUnit : VenomModule {
           } // else preserve prior expIn value
         }
         if (s==0 || inputs[LIN_INPUT].isPolyphonic()) {
-          linIn = (o && !disableOver[LIN_INPUT]) ? float_4::zero() : inputs[LIN_INPUT].getPolyVoltageSimd<float_4>(c);
+          linIn = (o && !holdOver[LIN_INPUT]) ? float_4::zero() : inputs[LIN_INPUT].getPolyVoltageSimd<float_4>(c);
           if (procOver[LIN_INPUT]){
             if (o==0) linIn *= oversample;
             linIn = linUpSample[s].process(linIn);
           }
         } // else preserve prior linIn value
         if (inputs[LIN_INPUT].isConnected() && !linDCCouple)
-          linIn = linDcBlockFilter[s].process(linIn); //, oversample);
+          linIn = linDcBlockFilter[s].process(linIn, dcCoef);
         float_4 rev{};
         if (inputs[REV_INPUT].isConnected()) {
           if (s==0 || inputs[REV_INPUT].isPolyphonic()) {
-            revIn = (o && !disableOver[REV_INPUT]) ? float_4::zero() : inputs[REV_INPUT].getPolyVoltageSimd<float_4>(c);
+            revIn = (o && !holdOver[REV_INPUT]) ? float_4::zero() : inputs[REV_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[REV_INPUT]){
               if (o==0) revIn *= oversample;
               revIn = revUpSample[s].process(revIn);
@@ -408,10 +884,35 @@ struct VCOUnit : VenomModule {
             rev[i] = revTrig[c+i].process(revIn[i], syncLo, syncHi);
           }
         }
-        float_4 sync{};
-        if (inputs[SYNC_INPUT].isConnected()) {
+        float_4 sync{}, syncP{};
+        if (inputs[SYNC_INPUT].isConnected() && subSampleSync) {
+          if (!o) {
+            if (s==0 || inputs[SYNC_INPUT].isPolyphonic()) {
+              syncIn = inputs[SYNC_INPUT].getPolyVoltageSimd<float_4>(c);
+            } // else preserve prior syncIn value
+            for (int i=0; i<4; i++){
+              if (syncTrig[c+i].process(syncIn[i], syncLo, syncHi) && !(noRetrigger && onceActive[s][i])) {
+                // Linear interpolation of the threshold crossing between the prior and current sample
+                float delta = syncIn[i] - syncPrev[c+i];
+                float t = delta > 0.f ? clamp((syncHi - syncPrev[c+i]) / delta, 0.f, 1.f) : 1.f;
+                int step = std::min(static_cast<int>(t * oversample), oversample - 1);
+                syncStep[c+i] = step + 1;
+                syncFrac[c+i] = step + 1 - t * oversample;
+              }
+              syncPrev[c+i] = syncIn[i];
+            }
+          }
+          for (int i=0; i<4; i++){
+            if (syncStep[c+i] == o+1) {
+              sync[i] = 1.f;
+              syncP[i] = syncFrac[c+i];
+              syncStep[c+i] = 0;
+            }
+          }
+        }
+        else if (inputs[SYNC_INPUT].isConnected()) {
           if (s==0 || inputs[SYNC_INPUT].isPolyphonic()) {
-            syncIn = (o && !disableOver[SYNC_INPUT]) ? float_4::zero() : inputs[SYNC_INPUT].getPolyVoltageSimd<float_4>(c);
+            syncIn = (o && !holdOver[SYNC_INPUT]) ? float_4::zero() : inputs[SYNC_INPUT].getPolyVoltageSimd<float_4>(c);
             if (procOver[SYNC_INPUT]){
               if (o==0) syncIn *= oversample;
               syncIn = syncUpSample[s].process(syncIn);
@@ -421,29 +922,42 @@ struct VCOUnit : VenomModule {
             sync[i] = syncTrig[c+i].process(syncIn[i], syncLo, syncHi) && !(noRetrigger && onceActive[s][i]);
           }
         } else onceActive[s] = float_4::zero();
-        if (!alternate) {
-          freq[s] = vOctIn[s] + vOctParm + expIn*expDepthIn[s]*params[EXP_PARAM].getValue();
+        if (pitchBlock) {
+          if (!o) {
+            float_4 pitch = dsp::exp2_taylor5(vOctIn[s] + vOctParm + unisonVOct[s] + expIn*expDepthIn[s]*params[EXP_PARAM].getValue());
+            pitchPrev[s] = pitchBlockReset ? pitch : pitchNext[s];
+            pitchNext[s] = pitch;
+          }
+          freq[s] = pitchPrev[s] + (pitchNext[s] - pitchPrev[s]) * ((o+1) * pitchStep) + linIn*linDepthIn[s]*params[LIN_PARAM].getValue();
+        } else if (!alternate) {
+          freq[s] = vOctIn[s] + vOctParm + unisonVOct[s] + expIn*expDepthIn[s]*params[EXP_PARAM].getValue();
           freq[s] = dsp::exp2_taylor5(freq[s]) + linIn*linDepthIn[s]*params[LIN_PARAM].getValue();
         } else {
           freq[s] = (vOctParm + vOctIn[s])*biasFreq + linIn*linDepthIn[s]*params[LIN_PARAM].getValue()*((params[OCTAVE_PARAM].getValue()+4.f)*3.f+1.f);
+          if (unisonOn)
+            freq[s] *= dsp::exp2_taylor5(unisonVOct[s]);
         }
         freq[s] *= modeFreq[mode];
         phasorDir[s] = simd::ifelse(rev>0.f, phasorDir[s]*-1.f, phasorDir[s]);
         phasorDir[s] = simd::ifelse(sync>0.f, 1.f, phasorDir[s]);
         basePhaseDelta = freq[s] * phasorDir[s] * k;
-        phasor[s] += basePhaseDelta;
-        if (aliasSuppress) {
+        if (once) {
+          float_4 tempPhasor = phasor[s] + basePhaseDelta;
+          onceActive[s] = simd::ifelse((tempPhasor<0.f) | (tempPhasor>=1000.f), float_4::zero(), onceActive[s]);
+        }
+        phase[s] += phasorToPhase32(basePhaseDelta);
+        if (antiAlias) {
           basePhaseDelta *= 0.001f;
-          lowFreq = simd::abs(basePhaseDelta) < 1e-3;
-          denInv = 1.f/basePhaseDelta;
-          denInv = denInv * denInv * 0.25;
+          if (antiAlias == 1) {
+            lowFreq = simd::abs(basePhaseDelta) < 1e-3;
+            denInv = 1.f/basePhaseDelta;
+            denInv = denInv * denInv * 0.25;
+          }
         }
-        float_4 tempPhasor = simd::fmod(phasor[s], 1000.f);
-        tempPhasor = simd::ifelse(tempPhasor<0.f, tempPhasor+1000.f, tempPhasor);
-        if (once)
-          onceActive[s] = simd::ifelse(tempPhasor != phasor[s], float_4::zero(), onceActive[s]);
-        phasor[s] = tempPhasor;
-        phasor[s] = simd::ifelse(sync>0.f, float_4::zero(), phasor[s]);
+        // Reset to 0, or to the phase advanced since the sub-sample sync crossing
+        simd::int32_4 syncPhase = subSampleSync ? phasorToPhase32(freq[s] * k * syncP) : simd::int32_4::zero();
+        phase[s] += (syncPhase - phase[s]) & simd::int32_4::cast(sync>0.f);
+        phasor[s] = phase32ToPhasor(phase[s]);
         if (once)
           onceActive[s] = simd::ifelse(sync>float_4::zero(), 1.f, onceActive[s]);
         if (gated){
@@ -455,7 +969,7 @@ struct VCOUnit : VenomModule {
 
         // Process Waveform
         if (s==0 || inputs[SHAPE_INPUT].isPolyphonic()) {
-          shapeIn = (o && !disableOver[SHAPE_INPUT]) ? float_4::zero() : inputs[SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
+          shapeIn = (o && !holdOver[SHAPE_INPUT]) ? float_4::zero() : inputs[SHAPE_INPUT].getPolyVoltageSimd<float_4>(c);
           if (procOver[SHAPE_INPUT]){
             if (o==0) shapeIn *= oversample;
             shapeIn = shapeUpSample[s].process(shapeIn);
@@ -463,162 +977,23 @@ struct VCOUnit : VenomModule {
         } // preserve prior shapeIn value
         float_4 shape = clamp(shapeIn*params[SHAPE_AMT_PARAM].getValue()*shpScale + params[SHAPE_PARAM].getValue(), -1.f, 1.f);
         if (s==0 || inputs[PHASE_INPUT].isPolyphonic()) {
-          phaseIn = (o && !disableOver[PHASE_INPUT]) ? float_4::zero() : inputs[PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
+          phaseIn = (o && !holdOver[PHASE_INPUT]) ? float_4::zero() : inputs[PHASE_INPUT].getPolyVoltageSimd<float_4>(c);
           if (procOver[PHASE_INPUT]){
             if (o==0) phaseIn *= oversample;
             phaseIn = phaseUpSample[s].process(phaseIn);
           }
         } // else preserve prior phaseIn value
 
-        float_4 shapeSign = 0.f;
-        float_4 phases[3]{};
-        switch (wave) {
-          case 0: // SIN
-            wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f - 250.f;
-            wavePhasor = simd::fmod(wavePhasor, 1000.f);
-            wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-            wavePhasor = sinSimd_1000(wavePhasor);
-            switch (shapeMode) {
-              case 0:  // exp/log
-                out[s] = crossfade(wavePhasor, ifelse(shape>0.f, 11.f*wavePhasor/(10.f*simd::abs(wavePhasor)+1.f), simd::sgn(wavePhasor)*simd::pow(wavePhasor,4)), ifelse(shape>0.f, shape, -shape))*5.f;
-                break;
-              case 1:  // J curve
-                out[s] = (normSigmoid((wavePhasor+1.f)/2.f, -shape*0.9f)*2.f-1.f) * 5.f;
-                break;
-              case 2: // S curve
-                out[s] = normSigmoid(wavePhasor, -shape*0.9f) * 5.f;
-                break;
-              case 3: // Rectify
-              case 4: // Normalized Rectify
-                shape = -shape;
-                shapeSign = simd::sgn(shape);
-                out[s] = simd::ifelse(shapeSign==0, wavePhasor, -(shapeSign*simd::abs(-wavePhasor+shapeSign-shape)-shapeSign+shape));
-                if (shapeMode==4) // Normalized rectify
-                  out[s] = -((1+simd::abs(shape))*-out[s]-shape);
-                out[s] *= 5.f;
-                break;
-              default: // 5 morph square <--> sine <--> saw
-                out[s] = wavePhasor * 5.f * (1.f - simd::abs(shape)); // sine component
-                // square and saw components
-                wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f;
-                wavePhasor = simd::fmod(wavePhasor + simd::ifelse(wavePhasor<0.f, 0.f, 500.f), 1000.f);
-                wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-                out[s] += simd::ifelse( shape<=0.f,
-                                        simd::ifelse(wavePhasor<500.f, 5.f, -5.f) * shape, // square component
-                                        (wavePhasor*0.01f - 5.f) * shape // saw component
-                                      );
-            } // end sine shape switch
-            break;
-          case 1: // TRI
-            wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f + 250.f;
-            wavePhasor = simd::fmod(wavePhasor, 1000.f);
-            wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-            if (shapeMode<=2) shape = simd::ifelse(wavePhasor<500.f, shape, -shape);
-            wavePhasor = simd::ifelse(wavePhasor<500.f, wavePhasor*.002f, (1000.f-wavePhasor)*.002f);
-            switch (shapeMode) {
-              case 0:  // exp/log
-                out[s] = crossfade(wavePhasor, ifelse(shape>0.f, 11.f*wavePhasor/(10.f*simd::abs(wavePhasor)+1.f), simd::sgn(wavePhasor)*simd::pow(wavePhasor,4)), ifelse(shape>0.f, shape, -shape))*10.f-5.f;
-                break;
-              case 1:  // J curve
-                out[s] = normSigmoid(wavePhasor, -shape*0.8) * 10.f - 5.f;
-                break;
-              case 2: // S curve
-                out[s] = normSigmoid(wavePhasor*2.f-1.f, -shape*0.8) * 5.f;
-                break;
-              case 3: // Rectify
-              case 4: // Normalized Rectify
-                shape = -shape;
-                shapeSign = simd::sgn(shape);
-                out[s] = wavePhasor*2.f-1.f;
-                out[s] = simd::ifelse(shapeSign==0, out[s], -(shapeSign*simd::abs(-out[s]+shapeSign-shape)-shapeSign+shape));
-                if (shapeMode==4) // Normalized Rectify
-                  out[s] = -((1+simd::abs(shape))*-out[s]-shape);
-                out[s] *= 5.f;
-                break;
-              default: // 5 morph sine <--> triangle <--> square
-                out[s] = (wavePhasor*10.f - 5.f) * (1.f - simd::abs(shape)); // triangle component
-                // sine and square components
-                wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f;
-                wavePhasor = simd::fmod(wavePhasor - simd::ifelse(shape<=0.f, 250.f, 0.f), 1000.f);
-                wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-                out[s] += simd::ifelse( shape<=0.f,
-                                        sinSimd_1000(wavePhasor)*5.f * -shape, // sine component
-                                        simd::ifelse(wavePhasor<500.f, 5.f, -5.f) * shape // square component
-                                      );
-            } // end triangle shape switch
-            break;
-          case 2: // SQR
-            wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f;
-            wavePhasor = simd::fmod(wavePhasor, 1000.f);
-            wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-            if (shapeMode==2) { // morph tri <--> sqr <--> saw
-              out[s] = simd::ifelse(wavePhasor<500.f, 5.f, -5.f) * (1.f - simd::abs(shape)); // square component
-              // triangle and saw components
-              wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f;
-              wavePhasor = simd::fmod(wavePhasor + simd::ifelse(shape<=0.f, 250.f, 500.f), 1000.f);
-              wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-              out[s] += simd::ifelse( shape<=0.f, 
-                                      (simd::ifelse(wavePhasor<500.f, wavePhasor, (1000.f-wavePhasor))*.02f - 5.f) * -shape, // triangle component
-                                      (wavePhasor*0.01f - 5.f) * shape // saw component
-                                    );
-            } else { // PWM
-              float_4 flip = (shapeIn*params[SHAPE_AMT_PARAM].getValue()*shpScale + params[SHAPE_PARAM].getValue() + 1.f) * 500.f;
-              if (!shapeMode) flip = clamp( flip, 30.f, 970.f );
-              out[s] = ifelse(wavePhasor<flip, 5.f, -5.f);
-              if (aliasSuppress) {
-                loadPhases(phases, wavePhasor * 0.001f, basePhaseDelta);
-                sawPhasor = aliasSuppressedSaw(phases, denInv);
-                offsetSawPhasor = aliasSuppressedOffsetSaw(phases, 1.f - flip*0.001f, denInv);
-                out[s] = ifelse(lowFreq, out[s], (offsetSawPhasor - sawPhasor + flip*0.001f - 0.5f) * 10.f);
-              }
-            }
-            break;
-          default: // 3 SAW
-            wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f;
-            wavePhasor = simd::fmod(wavePhasor, 1000.f);
-            wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-            wavePhasor *= 0.001f;
-            if (aliasSuppress && shapeMode < 3) {
-              loadPhases(phases, wavePhasor, basePhaseDelta);
-              wavePhasor = ifelse(lowFreq, wavePhasor, aliasSuppressedSaw(phases, denInv));
-            }
-            switch (shapeMode) {
-              case 0:  // exp/log
-                out[s] = crossfade(wavePhasor, ifelse(shape>0.f, 11.f*wavePhasor/(10.f*simd::abs(wavePhasor)+1.f), simd::sgn(wavePhasor)*simd::pow(wavePhasor,4)), ifelse(shape>0.f, shape, -shape))*10.f-5.f;
-                break;
-              case 1:  // J Curve
-                out[s] = normSigmoid(wavePhasor, -shape*0.90) * 10.f - 5.f;
-                break;
-              case 2: // S Curve
-                out[s] = normSigmoid(wavePhasor*2.f-1.f, -shape*0.85) * 5.f;
-                break;
-              case 3: // Rectify
-              case 4: // Normalized Rectify
-                shape = -shape;
-                shapeSign = simd::sgn(shape);
-                out[s] = wavePhasor*2.f-1.f;
-                out[s] = simd::ifelse(shapeSign==0, out[s], -(shapeSign*simd::abs(-out[s]+shapeSign-shape)-shapeSign+shape));
-                if (shapeMode==4) // Normalized Rectify
-                  out[s] = -((1+simd::abs(shape))*-out[s]-shape);
-                out[s] *= 5.f;
-                break;
-              default: // 5 morph square <--> saw <--> even
-                out[s] = (wavePhasor*10.f - 5.f) * simd::ifelse(shape<0.f, 1.f + shape, 1.f); // saw component
-                // square component
-                wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f;
-                wavePhasor = simd::fmod(wavePhasor + simd::ifelse(shape<=0.f, 500.f, 0.f), 1000.f);
-                wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-                out[s] += simd::ifelse(wavePhasor<500.f, 5.f, -5.f) * simd::abs(shape) * simd::ifelse(shape<0.f, 1.f, 0.5f);
-                // sine component
-                wavePhasor = phasor[s] + (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f;
-                wavePhasor = simd::fmod(wavePhasor, 1000.f);
-                wavePhasor = simd::ifelse(wavePhasor<0.f, wavePhasor+1000.f, wavePhasor);
-                out[s] += simd::ifelse(shape<0.f, 0.f, sinSimd_1000(wavePhasor) * 3.175 * shape);
-            } // end saw shape switch
-        } // end wave switch
+        float_4 waveOffset = (phaseIn*params[PHASE_AMT_PARAM].getValue() + params[PHASE_PARAM].getValue()*2.f)*250.f;
+        if (wavetableActive) {
+          out[s] = wavetableOut(phase32Phasor(phase[s], waveOffset), freq[s], args.sampleTime);
+        } else {
+          float_4 flip = (shapeIn*params[SHAPE_AMT_PARAM].getValue()*shpScale + params[SHAPE_PARAM].getValue() + 1.f) * 500.f;
+          out[s] = shapeWave(wave, shapeMode, antiAlias, phase[s], waveOffset, shape, flip, basePhaseDelta, lowFreq, denInv);
+        }
 
         if (s==0 || inputs[LEVEL_INPUT].isPolyphonic()) {
-          levelIn = (o && !disableOver[LEVEL_INPUT]) ? float_4::zero() : inputs[LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
+          levelIn = (o && !holdOver[LEVEL_INPUT]) ? float_4::zero() : inputs[LEVEL_INPUT].getPolyVoltageSimd<float_4>(c);
           if (procOver[LEVEL_INPUT]){
             if (o==0) levelIn *= oversample;
             levelIn = levelUpSample[s].process(levelIn);
@@ -630,7 +1005,7 @@ struct VCOUnit : VenomModule {
           level = simd::clamp(level, -1.f, 1.f);
 
         if (s==0 || inputs[OFFSET_INPUT].isPolyphonic()) {
-          offsetIn = (o && !disableOver[OFFSET_INPUT]) ? float_4::zero() : inputs[OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
+          offsetIn = (o && !holdOver[OFFSET_INPUT]) ? float_4::zero() : inputs[OFFSET_INPUT].getPolyVoltageSimd<float_4>(c);
           if (procOver[OFFSET_INPUT]){
             if (o==0) offsetIn *= oversample;
             offsetIn = offsetUpSample[s].process(offsetIn);
@@ -643,22 +1018,83 @@ struct VCOUnit : VenomModule {
         if (once){
           out[s] = simd::ifelse(onceActive[s]==float_4::zero(), float_4::zero(), out[s]);
         }
+        // Correct sub-sample sync discontinuities
+        if (subSampleSync && inputs[SYNC_INPUT].isConnected()) {
+          out[s] = syncBlep[s].process(out[s], sync>0.f, syncP);
+        }
+        // Sum unison voices, which are DC blocked and downsampled together below
+        if (unisonOn) {
+          unisonL += out[s] * unisonGainL[s];
+          unisonR += out[s] * unisonGainR[s];
+          continue;
+        }
         // Remove DC offset
         if (params[DC_PARAM].getValue()) {
-          out[s] = outDcBlockFilter[s].process(out[s]); //, oversample);
+          out[s] = outDcBlockFilter[s].process(out[s], dcCoef);
         }
         // Downsample outputs
         if (oversample>1) {
           out[s] = outDownSample[s].process(out[s]);
         }
       }
+      if (unisonOn) {
+        unisonOut = float_4(unisonL[0]+unisonL[1]+unisonL[2]+unisonL[3], unisonR[0]+unisonR[1]+unisonR[2]+unisonR[3], 0.f, 0.f);
+        if (params[DC_PARAM].getValue()) {
+          unisonOut = outDcBlockFilter[0].process(unisonOut, dcCoef);
+        }
+        if (oversample>1) {
+          unisonOut = outDownSample[0].process(unisonOut);
+        }
+      }
+    }
+    int outChannels = channels;
+    if (unisonOn) {
+      out[0] = unisonOut;
+      outChannels = unisonStereo ? 2 : 1;
     }
+    int outSimdCnt = (outChannels+3)/4;
+    pitchBlockReset = !pitchBlock;
     
+    if (lfoRate) {
+      // Ramp from the current output so it reaches the value predicted by the slope since the
+      // previous compute one sample before the next compute. Jump to the new value when a trigger
+      // forced the compute, a one shot started or ended, or the prediction missed by more than half
+      // of the last period's movement (square edges, saw resets, triangle corners), then compute
+      // again on the next sample to measure the new slope rather than holding the jump value.
+      int onceMask = 0;
+      for (int s=0; once && s<simdCnt; s++)
+        onceMask |= simd::movemask(onceActive[s] != float_4::zero()) << (s*4);
+      lfoSnap |= onceMask != lfoOnceMask;
+      lfoOnceMask = onceMask;
+      bool resume = lfoResume;
+      lfoResume = false;
+      for (int s=0; s<outSimdCnt; s++) {
+        float_4 snap = lfoSnap ? float_4::mask() : lfoMiss(out[s], lfoOut[s], lfoStep[s], resume);
+        lfoRamp(out[s], lfoOut[s], lfoStep[s], lfoPrev[s], snap, lfoElapsed);
+        lfoResume |= simd::movemask(snap);
+        out[s] = lfoOut[s];
+      }
+      lfoNext = lfoResume ? 1 : lfoDivision;
+      lfoChannels = outChannels;
+      lfoJump = false;
+    }
+
+    // Checked after the control rate ramp, so a bad value cannot linger in it.
+    // The control rate hold path runs the same check before its early return.
+    if (watchdogEnabled) {
+      for (int s=0; s<simdCnt; s++) {
+        if (watchdog(out[s]) | watchdog(phasor[s])) {
+          resetSimdState(s);
+          out[s] = lfoOut[s] = lfoStep[s] = lfoPrev[s] = float_4::zero();
+        }
+      }
+    }
+
     // Write output
-    for (int s=0, c=0; s<simdCnt; s++, c+=4) {
+    for (int s=0, c=0; s<outSimdCnt; s++, c+=4) {
       outputs[OUTPUT].setVoltageSimd( out[s], c );
     }
-    outputs[OUTPUT].setChannels(channels);
+    outputs[OUTPUT].setChannels(outChannels);
   }
   
   json_t* dataToJson() override {
@@ -673,7 +1109,17 @@ struct VCOUnit : VenomModule {
     json_object_set_new(rootJ, "overParam", json_integer(params[OVER_PARAM].getValue()));
     json_object_set_new(rootJ, "clampLevel", json_boolean(clampLevel));
     json_object_set_new(rootJ, "disableDPW", json_boolean(disableDPW));
+    json_object_set_new(rootJ, "polyBlep", json_boolean(polyBlep));
     json_object_set_new(rootJ, "syncAt0", json_boolean(syncLo<0.f));
+    json_object_set_new(rootJ, "subSampleSync", json_boolean(subSampleSync));
+    json_object_set_new(rootJ, "pitchBlockInterp", json_boolean(pitchBlockInterp));
+    json_object_set_new(rootJ, "autoOver", json_boolean(autoOver));
+    json_object_set_new(rootJ, "lfoControlRate", json_boolean(lfoControlRate));
+    json_object_set_new(rootJ, "wavetableMode", json_boolean(wavetableMode));
+    json_object_set_new(rootJ, "unison", json_integer(unison));
+    json_object_set_new(rootJ, "unisonSpread", json_integer(unisonSpread));
+    json_object_set_new(rootJ, "unisonRandomPhase", json_boolean(unisonRandomPhase));
+    json_object_set_new(rootJ, "unisonStereo", json_boolean(unisonStereo));
     json_object_set_new(rootJ, "shapeModeParam", json_integer(params[SHAPE_MODE_PARAM].getValue()));
     return rootJ;
   }
@@ -699,6 +1145,8 @@ struct VCOUnit : VenomModule {
     }
     val = json_object_get(rootJ, "disableDPW");
     disableDPW = val ? json_boolean_value(val) : true;
+    val = json_object_get(rootJ, "polyBlep");
+    polyBlep = val ? json_boolean_value(val) : false;
     setMode();
     if ((val = json_object_get(rootJ, "overParam"))) {
       params[OVER_PARAM].setValue(json_integer_value(val));
@@ -710,6 +1158,29 @@ struct VCOUnit : VenomModule {
       syncHi = json_boolean_value(val) ? 0.f : 2.f;
       syncLo = json_boolean_value(val) ? -2.f : 0.2f;
     }
+    val = json_object_get(rootJ, "subSampleSync");
+    subSampleSync = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "pitchBlockInterp");
+    pitchBlockInterp = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "autoOver");
+    autoOver = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "lfoControlRate");
+    lfoControlRate = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "wavetableMode");
+    setWavetableMode(val ? json_boolean_value(val) : false);
+    if ((val = json_object_get(rootJ, "unison"))) {
+      unison = clamp(static_cast<int>(json_integer_value(val)), 1, 16);
+    }
+    if ((val = json_object_get(rootJ, "unisonSpread"))) {
+      unisonSpread = clamp(static_cast<int>(json_integer_value(val)), 0, static_cast<int>(unisonSpreadValues.size())-1);
+    }
+    if ((val = json_object_get(rootJ, "unisonRandomPhase"))) {
+      unisonRandomPhase = json_boolean_value(val);
+    }
+    if ((val = json_object_get(rootJ, "unisonStereo"))) {
+      unisonStereo = json_boolean_value(val);
+    }
+    unisonChanged();
     setWave();
     if ((val = json_object_get(rootJ, "shapeModeParam"))) {
       params[SHAPE_MODE_PARAM].setValue(json_integer_value(val));
@@ -885,23 +1356,23 @@ struct VCOUnitWidget : VenomWidget {
     VenomWidget::step();
     VCOUnit* mod = dynamic_cast<VCOUnit*>(this->module);
     if(mod) {
-      bool over = mod->params[VCOUnit::OVER_PARAM].getValue();
-      mod->lights[VCOUnit::REV_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::REV_INPUT]) && mod->inputs[VCOUnit::REV_INPUT].isConnected());
-      mod->lights[VCOUnit::REV_LIGHT+1].setBrightness(over && mod->disableOver[VCOUnit::REV_INPUT] && mod->inputs[VCOUnit::REV_INPUT].isConnected());
-      mod->lights[VCOUnit::EXP_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::EXP_INPUT]) && mod->inputs[VCOUnit::EXP_INPUT].isConnected() && !(mod->alternate));
-      mod->lights[VCOUnit::EXP_LIGHT+1].setBrightness(over && mod->disableOver[VCOUnit::EXP_INPUT] && mod->inputs[VCOUnit::EXP_INPUT].isConnected() && !(mod->alternate));
-      mod->lights[VCOUnit::LIN_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::LIN_INPUT]) && mod->inputs[VCOUnit::LIN_INPUT].isConnected());
-      mod->lights[VCOUnit::LIN_LIGHT+1].setBrightness(over && mod->disableOver[VCOUnit::LIN_INPUT] && mod->inputs[VCOUnit::LIN_INPUT].isConnected());
-      mod->lights[VCOUnit::SYNC_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::SYNC_INPUT]) && mod->inputs[VCOUnit::SYNC_INPUT].isConnected());
-      mod->lights[VCOUnit::SYNC_LIGHT+1].setBrightness(over && mod->disableOver[VCOUnit::SYNC_INPUT] && mod->inputs[VCOUnit::SYNC_INPUT].isConnected());
-      mod->lights[VCOUnit::SHAPE_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::SHAPE_INPUT]) && mod->inputs[VCOUnit::SHAPE_INPUT].isConnected());
-      mod->lights[VCOUnit::SHAPE_LIGHT+1].setBrightness(over && mod->disableOver[VCOUnit::SHAPE_INPUT] && mod->inputs[VCOUnit::SHAPE_INPUT].isConnected());
-      mod->lights[VCOUnit::PHASE_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::PHASE_INPUT]) && mod->inputs[VCOUnit::PHASE_INPUT].isConnected());
-      mod->lights[VCOUnit::PHASE_LIGHT+1].setBrightness(over && mod->disableOver[VCOUnit::PHASE_INPUT] && mod->inputs[VCOUnit::PHASE_INPUT].isConnected());
-      mod->lights[VCOUnit::OFFSET_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::OFFSET_INPUT]) && mod->inputs[VCOUnit::OFFSET_INPUT].isConnected());
-      mod->lights[VCOUnit::OFFSET_LIGHT+1].setBrightness(over && mod->disableOver[VCOUnit::OFFSET_INPUT] && mod->inputs[VCOUnit::OFFSET_INPUT].isConnected());
-      mod->lights[VCOUnit::LEVEL_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::LEVEL_INPUT]) && mod->inputs[VCOUnit::LEVEL_INPUT].isConnected());
-      mod->lights[VCOUnit::LEVEL_LIGHT+1].setBrightness(over && mod->disableOver[VCOUnit::LEVEL_INPUT] && mod->inputs[VCOUnit::LEVEL_INPUT].isConnected());
+      bool over = mod->params[VCOUnit::OVER_PARAM].getValue() && !mod->lfoRate && !mod->wavetableActive;
+      mod->lights[VCOUnit::REV_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::REV_INPUT] || mod->autoSlow[VCOUnit::REV_INPUT]) && mod->inputs[VCOUnit::REV_INPUT].isConnected());
+      mod->lights[VCOUnit::REV_LIGHT+1].setBrightness(over && (mod->disableOver[VCOUnit::REV_INPUT] || mod->autoSlow[VCOUnit::REV_INPUT]) && mod->inputs[VCOUnit::REV_INPUT].isConnected());
+      mod->lights[VCOUnit::EXP_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::EXP_INPUT] || mod->autoSlow[VCOUnit::EXP_INPUT] || mod->pitchBlockInterp) && mod->inputs[VCOUnit::EXP_INPUT].isConnected() && !(mod->alternate));
+      mod->lights[VCOUnit::EXP_LIGHT+1].setBrightness(over && (mod->disableOver[VCOUnit::EXP_INPUT] || mod->autoSlow[VCOUnit::EXP_INPUT] || mod->pitchBlockInterp) && mod->inputs[VCOUnit::EXP_INPUT].isConnected() && !(mod->alternate));
+      mod->lights[VCOUnit::LIN_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::LIN_INPUT] || mod->autoSlow[VCOUnit::LIN_INPUT]) && mod->inputs[VCOUnit::LIN_INPUT].isConnected());
+      mod->lights[VCOUnit::LIN_LIGHT+1].setBrightness(over && (mod->disableOver[VCOUnit::LIN_INPUT] || mod->autoSlow[VCOUnit::LIN_INPUT]) && mod->inputs[VCOUnit::LIN_INPUT].isConnected());
+      mod->lights[VCOUnit::SYNC_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::SYNC_INPUT] || mod->autoSlow[VCOUnit::SYNC_INPUT] || mod->subSampleSync) && mod->inputs[VCOUnit::SYNC_INPUT].isConnected());
+      mod->lights[VCOUnit::SYNC_LIGHT+1].setBrightness(over && (mod->disableOver[VCOUnit::SYNC_INPUT] || mod->autoSlow[VCOUnit::SYNC_INPUT] || mod->subSampleSync) && mod->inputs[VCOUnit::SYNC_INPUT].isConnected());
+      mod->lights[VCOUnit::SHAPE_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::SHAPE_INPUT] || mod->autoSlow[VCOUnit::SHAPE_INPUT]) && mod->inputs[VCOUnit::SHAPE_INPUT].isConnected());
+      mod->lights[VCOUnit::SHAPE_LIGHT+1].setBrightness(over && (mod->disableOver[VCOUnit::SHAPE_INPUT] || mod->autoSlow[VCOUnit::SHAPE_INPUT]) && mod->inputs[VCOUnit::SHAPE_INPUT].isConnected());
+      mod->lights[VCOUnit::PHASE_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::PHASE_INPUT] || mod->autoSlow[VCOUnit::PHASE_INPUT]) && mod->inputs[VCOUnit::PHASE_INPUT].isConnected());
+      mod->lights[VCOUnit::PHASE_LIGHT+1].setBrightness(over && (mod->disableOver[VCOUnit::PHASE_INPUT] || mod->autoSlow[VCOUnit::PHASE_INPUT]) && mod->inputs[VCOUnit::PHASE_INPUT].isConnected());
+      mod->lights[VCOUnit::OFFSET_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::OFFSET_INPUT] || mod->autoSlow[VCOUnit::OFFSET_INPUT]) && mod->inputs[VCOUnit::OFFSET_INPUT].isConnected());
+      mod->lights[VCOUnit::OFFSET_LIGHT+1].setBrightness(over && (mod->disableOver[VCOUnit::OFFSET_INPUT] || mod->autoSlow[VCOUnit::OFFSET_INPUT]) && mod->inputs[VCOUnit::OFFSET_INPUT].isConnected());
+      mod->lights[VCOUnit::LEVEL_LIGHT].setBrightness(over && !(mod->disableOver[VCOUnit::LEVEL_INPUT] || mod->autoSlow[VCOUnit::LEVEL_INPUT]) && mod->inputs[VCOUnit::LEVEL_INPUT].isConnected());
+      mod->lights[VCOUnit::LEVEL_LIGHT+1].setBrightness(over && (mod->disableOver[VCOUnit::LEVEL_INPUT] || mod->autoSlow[VCOUnit::LEVEL_INPUT]) && mod->inputs[VCOUnit::LEVEL_INPUT].isConnected());
       mod->lights[VCOUnit::LIN_DC_LIGHT].setBrightness(mod->linDCCouple);
     }
   }
@@ -910,15 +1381,16 @@ struct VCOUnitWidget : VenomWidget {
     VCOUnit* module = dynamic_cast<VCOUnit*>(this->module);
     menu->addChild(new MenuSeparator);
     menu->addChild(createBoolPtrMenuItem("Limit level to 100%", "", &module->clampLevel));
-    menu->addChild(createBoolMenuItem("Disable DPW anti-alias", "",
-      [=]() {
-        return module->disableDPW;
-      },
-      [=](bool val) {
-        module->disableDPW = val;
+    menu->addChild(createIndexSubmenuItem(
+      "Anti-alias",
+      {"DPW", "polyBLEP / polyBLAMP", "Off"},
+      [=]() {return module->disableDPW ? 2 : module->polyBlep ? 1 : 0;},
+      [=](int val) {
+        module->disableDPW = val==2;
+        module->polyBlep = val==1;
         module->setMode(true);
       }
-    ));    
+    ));
     menu->addChild(createIndexSubmenuItem(
       "Sync trigger threshold",
       {"High 2V, Low 0.2V", "High 0V, Low -2V"},
@@ -928,6 +1400,55 @@ struct VCOUnitWidget : VenomWidget {
         module->syncLo = val ? -2.f : 0.2f;
       }
     ));
+    menu->addChild(createBoolPtrMenuItem("Sub-sample sync (sync input not oversampled)", "", &module->subSampleSync));
+    menu->addChild(createBoolPtrMenuItem("Interpolate oversampled pitch (exponential FM not oversampled)", "", &module->pitchBlockInterp));
+    menu->addChild(createBoolPtrMenuItem("Automatic input oversampling (slow CV not oversampled)", "", &module->autoOver));
+    menu->addChild(createBoolPtrMenuItem("Control rate low frequency modes (no oversampling)", "", &module->lfoControlRate));
+    menu->addChild(createBoolMenuItem("Band-limited wavetable for unmodulated shapes (no oversampling)", "",
+      [=]() {
+        return module->wavetableMode;
+      },
+      [=](bool val){
+        module->setWavetableMode(val);
+      }
+    ));
+    menu->addChild(createSubmenuItem("Unison", module->unison>1 ? std::to_string(module->unison)+" voices" : "Off",
+      [=](Menu *menu){
+        std::vector<std::string> voices = {"Off"};
+        for (int i=2; i<=16; i++)
+          voices.push_back(std::to_string(i));
+        menu->addChild(createIndexSubmenuItem("Voices", voices,
+          [=]() {return module->unison-1;},
+          [=](int val) {
+            module->unison = val+1;
+            module->unisonChanged();
+          }
+        ));
+        menu->addChild(createIndexSubmenuItem("Detune spread", {"5 cents", "10 cents", "20 cents", "35 cents", "50 cents", "100 cents"},
+          [=]() {return module->unisonSpread;},
+          [=](int val) {
+            module->unisonSpread = val;
+            module->unisonChanged();
+          }
+        ));
+        menu->addChild(createBoolMenuItem("Randomize voice phases", "",
+          [=]() {return module->unisonRandomPhase;},
+          [=](bool val) {
+            module->unisonRandomPhase = val;
+            module->unisonChanged();
+          }
+        ));
+        menu->addChild(createIndexSubmenuItem("Output", {"Mono", "Stereo spread"},
+          [=]() {return module->unisonStereo ? 1 : 0;},
+          [=](int val) {
+            module->unisonStereo = val;
+            module->unisonChanged();
+          }
+        ));
+        menu->addChild(createMenuLabel("Note: each voice reads its own channel of polyphonic inputs,"));
+        menu->addChild(createMenuLabel("so a monophonic V/Oct tunes all voices together"));
+      }
+    ));
     VenomWidget::appendContextMenu(menu);
   }
 
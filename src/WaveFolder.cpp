@@ -45,7 +45,14 @@ struct WaveFolder : VenomModule {
   float stageRaw = -1.f;
   simd::float_4 stageParm{};
   bool disableOver[3]{}, bipolar[2]{};
-
+  // Antiderivative anti-aliasing: each fold stage is averaged across the line between its prior
+  // and current input, which removes most aliasing at low oversampling rates
+  bool adaa = false;
+  // Linked stereo pairs: audio channels 2n and 2n+1 share CV channel n, so the CV scaling and
+  // oversampling is computed once per pair
+  bool linked = false;
+  simd::float_4 foldPrev[4][6]{};
+  int foldPrevState = 0; // ADAA stage count and linking that foldPrev was computed with, 0 if ADAA was off
 
   WaveFolder() {
     venomConfig(PARAMS_LEN, INPUTS_LEN, OUTPUTS_LEN, LIGHTS_LEN);
@@ -78,6 +85,7 @@ struct WaveFolder : VenomModule {
     configBypass(POLY_INPUT, POLY_OUTPUT);
     
     oversampleStages = 5;
+    watchdogAvailable = true;
   }
   
   void setOversample() override {
@@ -92,6 +100,28 @@ struct WaveFolder : VenomModule {
     }
   }
 
+  // Fold stage 2*clamp(k*x, -5, 5) - x with first order ADAA, from prior input x0 to current input x1.
+  // The -x term averages to the midpoint, and the clamp term uses its antiderivative,
+  // k*x*x/2 within the linear region and sgn(k)*(5*|x| - 12.5/|k|) beyond it.
+  // Both inputs on the same linear segment average to exactly the stage at the midpoint,
+  // which also avoids the ill conditioned division for small steps.
+  static simd::float_4 foldStageADAA(simd::float_4 x0, simd::float_4 x1, simd::float_4 k) {
+    using float_4 = simd::float_4;
+    float_4 ak = simd::fmax(simd::fabs(k), 1e-9f);
+    float_4 lim = 5.f / ak;
+    float_4 sk = simd::ifelse(k < 0.f, -1.f, 1.f);
+    float_4 r0 = simd::ifelse(x0 > lim, 1.f, simd::ifelse(x0 < -lim, -1.f, 0.f));
+    float_4 r1 = simd::ifelse(x1 > lim, 1.f, simd::ifelse(x1 < -lim, -1.f, 0.f));
+    float_4 c0 = simd::ifelse(r0 == 0.f, k * x0 * x0 * 0.5f, sk * (5.f * simd::fabs(x0) - 12.5f / ak));
+    float_4 c1 = simd::ifelse(r1 == 0.f, k * x1 * x1 * 0.5f, sk * (5.f * simd::fabs(x1) - 12.5f / ak));
+    float_4 dx = x1 - x0;
+    float_4 mid = (x0 + x1) * 0.5f;
+    return simd::ifelse((r0 == r1) | (simd::fabs(dx) < 1e-3f),
+      simd::clamp(mid * k, -5.f, 5.f) * 2.f - mid,
+      (c1 - c0) * 2.f / dx - mid
+    );
+  }
+
   void process(const ProcessArgs& args) override {
     VenomModule::process(args);
     
@@ -116,28 +146,36 @@ struct WaveFolder : VenomModule {
          biasOver = inputs[BIAS_INPUT].isConnected() && !disableOver[BIAS_INPUT] && oversample>1;
     
     int stages = static_cast<int>(params[STAGES_PARAM].getValue())+2;
-    int channels = 1;
-    for (int i=0; i<INPUTS_LEN; i++)
-      channels = std::max({channels, inputs[i].getChannels()});
+    // Fold history from another stage count or linking, or from before ADAA was enabled, is discarded.
+    // The first sample then folds each stage directly rather than averaging across a stale input.
+    int foldState = adaa ? stages * 2 + linked : 0;
+    bool foldFresh = foldState != foldPrevState;
+    foldPrevState = foldState;
+    int channels = 1, cvChannels = 1;
+    for (int i=0; i<POLY_INPUT; i++)
+      cvChannels = std::max({cvChannels, inputs[i].getChannels()});
+    if (linked) {
+      // each CV channel drives a pair of audio channels
+      channels = std::max({2, inputs[POLY_INPUT].getChannels(), std::min(cvChannels * 2, 16)});
+      cvChannels = (channels + 1) / 2;
+    } else {
+      channels = cvChannels = std::max({cvChannels, inputs[POLY_INPUT].getChannels()});
+    }
     
     float_4 in[4]{}, out[4]{}, pre[4]{}, stage[4]{}, bias[4]{};
     for (int o=0; o<oversample; o++) {
-      for (int i=0, c=0; c<channels; i++, c+=4){
+      for (int i=0, c=0; c<cvChannels; i++, c+=4){
         if (!o) {
           pre[i] = inputs[PRE_INPUT].getPolyVoltageSimd<float_4>(c);
           stage[i] = inputs[STAGE_INPUT].getPolyVoltageSimd<float_4>(c);
           bias[i] = inputs[BIAS_INPUT].getPolyVoltageSimd<float_4>(c);
-          in[i] = inputs[POLY_INPUT].getPolyVoltageSimd<float_4>(c) * oversample;
         }
-        if (oversample > 1) {
-          in[i] = upSample[i].process(o ? float_4::zero() : in[i]);
         if (preOver)
-            pre[i] = preUpSample[i].process(o ? float_4::zero() : pre[i]*oversample);
+          pre[i] = preUpSample[i].process(o ? float_4::zero() : pre[i]*oversample);
         if (stageOver)
           stage[i] = stageUpSample[i].process(o ? float_4::zero() : stage[i]*oversample);
         if (biasOver)
           bias[i] = biasUpSample[i].process(o ? float_4::zero() : bias[i]*oversample);
-        }
         if (!o || preOver) {
           pre[i] = pre[i] * preAmt + preParm;
           if (!bipolar[PRE_INPUT])
@@ -150,14 +188,49 @@ struct WaveFolder : VenomModule {
         }
         if (!o || biasOver)
           bias[i] = bias[i] * biasAmt + biasParm;
-        out[i] = (in[i] + bias[i]) * pre[i];
-        for (int s=0; s<stages; s++)
-          out[i] = simd::clamp( out[i] * stage[i], -5.f, 5.f) * 2.f - out[i];
+      }
+      for (int i=0, c=0; c<channels; i++, c+=4){
+        if (!o)
+          in[i] = inputs[POLY_INPUT].getPolyVoltageSimd<float_4>(c) * oversample;
+        if (oversample > 1)
+          in[i] = upSample[i].process(o ? float_4::zero() : in[i]);
+        float_4 preV = pre[i], stageV = stage[i], biasV = bias[i];
+        if (linked) {
+          int g = i / 2, l = (i % 2) * 2;
+          preV = float_4(pre[g][l], pre[g][l], pre[g][l+1], pre[g][l+1]);
+          stageV = float_4(stage[g][l], stage[g][l], stage[g][l+1], stage[g][l+1]);
+          biasV = float_4(bias[g][l], bias[g][l], bias[g][l+1], bias[g][l+1]);
+        }
+        out[i] = (in[i] + biasV) * preV;
+        if (adaa) {
+          for (int s=0; s<stages; s++) {
+            float_4 x0 = (foldFresh && !o) ? out[i] : foldPrev[i][s];
+            foldPrev[i][s] = out[i];
+            out[i] = foldStageADAA(x0, out[i], stageV);
+          }
+        } else {
+          for (int s=0; s<stages; s++)
+            out[i] = simd::clamp( out[i] * stageV, -5.f, 5.f) * 2.f - out[i];
+        }
         out[i] = softClip(out[i]*limit) / limit;
         if (oversample > 1)
           out[i] = downSample[i].process(out[i]);
       }
     }
+    if (watchdogEnabled) {
+      for (int i=0, c=0; c<channels; i++, c+=4){
+        if (watchdog(out[i])) {
+          int g = linked ? i / 2 : i;
+          preUpSample[g].reset();
+          stageUpSample[g].reset();
+          biasUpSample[g].reset();
+          upSample[i].reset();
+          downSample[i].reset();
+          foldPrevState = 0;
+          out[i] = float_4::zero();
+        }
+      }
+    }
     for (int i=0, c=0; c<channels; i++, c+=4)
       outputs[POLY_OUTPUT].setVoltageSimd(out[i], c);
     outputs[POLY_OUTPUT].setChannels(channels);
@@ -170,6 +243,8 @@ struct WaveFolder : VenomModule {
     json_object_set_new(rootJ, "stageAmpDisableOver", json_boolean(disableOver[STAGE_INPUT]));
     json_object_set_new(rootJ, "stageAmpBipolar", json_boolean(bipolar[STAGE_INPUT]));
     json_object_set_new(rootJ, "biasDisableOver", json_boolean(disableOver[BIAS_INPUT]));
+    json_object_set_new(rootJ, "adaa", json_boolean(adaa));
+    json_object_set_new(rootJ, "linked", json_boolean(linked));
     return rootJ;
   }
 
@@ -193,6 +268,10 @@ struct WaveFolder : VenomModule {
     if ((val = json_object_get(rootJ, "biasDisableOver"))) {
       disableOver[BIAS_INPUT] = json_boolean_value(val);
     }
+    val = json_object_get(rootJ, "adaa");
+    adaa = val ? json_boolean_value(val) : false;
+    val = json_object_get(rootJ, "linked");
+    linked = val ? json_boolean_value(val) : false;
   }
 
 };
@@ -270,6 +349,14 @@ struct WaveFolderWidget : VenomWidget {
     addOutput(createOutputCentered<PolyPort>(Vec(66.f, 335.5f), module, WaveFolder::POLY_OUTPUT));
   }
 
+  void appendContextMenu(Menu* menu) override {
+    WaveFolder* module = dynamic_cast<WaveFolder*>(this->module);
+    menu->addChild(new MenuSeparator);
+    menu->addChild(createBoolPtrMenuItem("Antiderivative anti-aliasing (ADAA)", "", &module->adaa));
+    menu->addChild(createBoolPtrMenuItem("Linked stereo pairs (CV channel 1 drives audio channels 1 and 2, etc.)", "", &module->linked));
+    VenomWidget::appendContextMenu(menu);
+  }
+
   void step() override {
     VenomWidget::step();
     if(this->module) {
@@ -40,8 +40,51 @@ inline float sin_01(float t) {
   return t;
 }
 
+// SIMD version of sin_01 for a [0, 1000] phasor, returning a cosine phase (1 at 0 and 1000)
+inline simd::float_4 sinSimd_1000(simd::float_4 t) {
+  t = simd::ifelse(t > 500.f, 1000.f - t, t) * 0.002f - 0.5f;
+  simd::float_4 t2 = t * t;
+  return -(((-0.540347 * t2 + 2.53566) * t2 - 5.16651) * t2 + 3.14159) * t;
+}
+
 // Normalized Tunable Sigmoid Function: see https://dhemery.github.io/DHE-Modules/technical/sigmoid/#function
 template <typename T1, typename T2>
 T1 normSigmoid(T1 x, T2 k) {
   return (x - k*x)/(k - 2.f*k*fabs(x) + 1.f);
 }
+
+// 32 bit fixed point phase, where the full range of a 32 bit integer is one cycle, so wrap-around is free.
+// The oscillators use a float phasor range of [0, 1000) for their shape math.
+
+// Convert a phasor offset or increment of any magnitude to wrapped 32 bit phase
+inline simd::int32_4 phasorToPhase32(simd::float_4 x) {
+  x *= 0.001f;
+  x -= simd::float_4(simd::int32_4(x)); // discard whole cycles
+  return simd::int32_4(x * 2147483648.f) << 1;
+}
+
+// Convert 32 bit phase to the [0, 1000) phasor range, keeping the 24 bits a float can represent
+inline simd::float_4 phase32ToPhasor(simd::int32_4 phase) {
+  return simd::float_4((phase >> 8) & 0xFFFFFF) * (1000.f / 16777216.f);
+}
+
+// Wrapped [0, 1000) phasor of 32 bit phase plus a phasor offset
+inline simd::float_4 phase32Phasor(simd::int32_4 phase, simd::float_4 offset) {
+  return phase32ToPhasor(phase + phasorToPhase32(offset));
+}
+
+// Polynomial band-limited step (polyBLEP) residual for a unit upward step at phase 0, where t is
+// the [0, 1) phase and dt the absolute phase increment per sample. Add it scaled by the step height.
+inline simd::float_4 polyBlep(simd::float_4 t, simd::float_4 dt) {
+  simd::float_4 x = simd::ifelse(t < 0.5f, t, t - 1.f) / dt; // samples from the step
+  simd::float_4 r = 1.f - simd::fabs(x);
+  return simd::ifelse(r > 0.f, simd::ifelse(x < 0.f, 0.5f, -0.5f) * r * r, 0.f);
+}
+
+// Polynomial band-limited ramp (polyBLAMP) residual for a corner at phase 0 where the slope
+// increases by 1 per phase cycle. Add it scaled by the slope change.
+inline simd::float_4 polyBlamp(simd::float_4 t, simd::float_4 dt) {
+  simd::float_4 x = simd::ifelse(t < 0.5f, t, t - 1.f) / dt;
+  simd::float_4 r = 1.f - simd::fabs(x);
+  return simd::ifelse(r > 0.f, r * r * r * (1.f / 6.f), 0.f) * dt;
+}
@@ -135,6 +135,9 @@ struct VenomModule : Module {
   int prevDarkTheme = -1;
   int oversampleStages = 0; // default to 0 = unused
   virtual void setOversample(){};
+  bool watchdogAvailable = false; // set true by modules that check recursive filter state
+  bool watchdogEnabled = false;
+  unsigned int watchdogCount[2]{}; // NaN, Infinity
   bool drawn = false;
   bool paramsInitialized = false;
   bool extProcNeeded = true;
@@ -362,6 +365,24 @@ struct VenomModule : Module {
   
   virtual void initialPostDrawnProcess(){}
 
+  // Cheap check of a recursive path output for NaN or Infinity values.
+  // Returns true (and tallies the event) if the caller should reset the filter state that produced x.
+  // Denormals are not checked, since Rack runs the engine with denormals flushed to zero.
+  bool watchdog(simd::float_4 x) {
+    simd::float_4 a = simd::fabs(x);
+    int nan = simd::movemask(a != a);
+    int inf = simd::movemask(a == simd::float_4(INFINITY));
+    if (!(nan | inf))
+      return false;
+    if (nan) watchdogCount[0]++;
+    if (inf) watchdogCount[1]++;
+    return true;
+  }
+
+  bool watchdog(float x) {
+    return watchdog(simd::float_4(x));
+  }
+
   json_t* dataToJson() override {
     json_t* rootJ = json_object();
     for (int i=0; i<getNumParams(); i++){
@@ -390,6 +411,8 @@ struct VenomModule : Module {
     json_object_set_new(rootJ, "currentTheme", json_integer(currentTheme));
     if (oversampleStages)
       json_object_set_new(rootJ, "oversampleStages", json_integer(oversampleStages));
+    if (watchdogAvailable)
+      json_object_set_new(rootJ, "watchdog", json_boolean(watchdogEnabled));
     return rootJ;
   }
 
@@ -449,6 +472,10 @@ struct VenomModule : Module {
       val = json_object_get(rootJ, "oversampleStages");
       oversampleStages = val ? json_integer_value(val) : 3;
     }
+    if (watchdogAvailable) {
+      val = json_object_get(rootJ, "watchdog");
+      watchdogEnabled = val ? json_boolean_value(val) : false;
+    }
   }
 
 };
@@ -487,6 +514,25 @@ struct VenomWidget : ModuleWidget {
       ));
     }
 
+    if (module->watchdogAvailable){
+      menu->addChild(new MenuSeparator);
+      menu->addChild(createBoolPtrMenuItem("NaN/Infinity watchdog", "", &module->watchdogEnabled));
+      if (module->watchdogEnabled){
+        menu->addChild(createSubmenuItem("Watchdog counters", "",
+          [=](Menu *menu){
+            menu->addChild(createMenuLabel("NaN: "+std::to_string(module->watchdogCount[0])));
+            menu->addChild(createMenuLabel("Infinity: "+std::to_string(module->watchdogCount[1])));
+            menu->addChild(createMenuItem("Reset counters", "",
+              [=]() {
+                for (int i=0; i<2; i++)
+                  module->watchdogCount[i] = 0;
+              }
+            ));
+          }
+        ));
+      }
+    }
+
     if (module->lockableParams){
       menu->addChild(new MenuSeparator);
       menu->addChild(createMenuItem("Lock all parameters", "",
@@ -0,0 +1,211 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+// Checks of the Filter.hpp filters
+
+#include "../test.hpp"
+#include "../../src/Filter.hpp"
+#include <functional>
+
+VENOM_TEST(dcBlockTest) {
+  // The cutoff should stay the same at any sample rate and oversample rate,
+  // so a step decays to 1/e after one time constant of 1/(2*pi*7.64 Hz)
+  char name[80];
+  float rates[3]{44100.f, 48000.f, 192000.f};
+  for (float rate : rates) {
+    for (int over=1; over<=32; over*=4) {
+      DCBlockFilter_4 f;
+      float k = DCBlockFilter_4::coefficient(rate, over);
+      int n = static_cast<int>(rate * over / 48.f);
+      float y = 0.f;
+      for (int i=0; i<n; i++)
+        y = f.process(simd::float_4(1.f), k)[0];
+      std::snprintf(name, sizeof(name), "DCBlockFilter_4 %g Hz x%d time constant", rate, over);
+      venomTest::checkMax(name, std::fabs(y - std::exp(-1.0)), 1e-3);
+    }
+  }
+  // A primed filter stays at 0 on its held input
+  DCBlockFilter_4 f;
+  f.prime(simd::float_4(3.f));
+  float k = DCBlockFilter_4::coefficient(48000.f);
+  float err = 0.f;
+  for (int i=0; i<100; i++)
+    err = std::fmax(err, std::fabs(f.process(simd::float_4(3.f), k)[0]));
+  venomTest::checkMax("DCBlockFilter_4 primed on a held input", err, 0.0);
+}
+
+VENOM_TEST(oversampleFilterTest) {
+  char name[80];
+  for (int stages=3; stages<=5; stages++) {
+    for (int over=2; over<=32; over*=2) {
+      OversampleFilter_4 f;
+      f.setOversample(over, stages);
+      // The DC group delay is the centroid of the impulse response, which should match latency
+      double sum = 0.0, moment = 0.0;
+      for (int n=0; n<over*4000; n++) {
+        double h = f.process(simd::float_4(n == 0 ? 1.f : 0.f))[0];
+        sum += h;
+        moment += n * h;
+      }
+      std::snprintf(name, sizeof(name), "OversampleFilter_4 %d stages x%d DC gain", stages, over);
+      venomTest::checkMax(name, std::fabs(sum - 1.0), 2e-4);
+      std::snprintf(name, sizeof(name), "OversampleFilter_4 %d stages x%d latency", stages, over);
+      venomTest::checkMax(name, std::fabs(moment / sum / over - f.latency), 0.01);
+
+      // Upsampling a held 3 V input, fed zero-stuffed the way the modules feed it, matches the
+      // output of a filter that has run on that input all along, from the first sub-sample
+      OversampleFilter_4 settled;
+      settled.setOversample(over, stages);
+      for (int n=0; n<over*1000; n++)
+        settled.process(simd::float_4(n % over ? 0.f : 3.f * over));
+      f.reset();
+      f.prime(simd::float_4(3.f));
+      double err = 0.0;
+      for (int n=0; n<over*100; n++) {
+        float x = n % over ? 0.f : 3.f * over;
+        float y = f.process(simd::float_4(x))[0];
+        err = std::max(err, static_cast<double>(std::fabs(y - settled.process(simd::float_4(x))[0])));
+      }
+      std::snprintf(name, sizeof(name), "OversampleFilter_4 %d stages x%d prime", stages, over);
+      venomTest::checkMax(name, err, 2e-4);
+    }
+  }
+}
+
+namespace {
+
+// Runs a detector on a 4 channel input for one second, returning the final decision
+bool detect(std::function<float(int c, float t)> signal, float sampleRate = 48000.f) {
+  AudioRateDetector d;
+  engine::Input in;
+  in.channels = 4;
+  d.reset();
+  bool audio = true;
+  for (int i=0; i<sampleRate; i++) {
+    for (int c=0; c<4; c++)
+      in.voltages[c] = signal(c, i / sampleRate);
+    audio = d.process(in, sampleRate);
+  }
+  return audio;
+}
+
+} // namespace
+
+VENOM_TEST(audioRateDetectorTest) {
+  auto sine = [](float amp, float freq) {
+    return [=](int c, float t) {return c ? 0.f : amp * std::sin(2.f * M_PI * freq * t);};
+  };
+  // The decision depends on frequency, not level
+  venomTest::check(detect(sine(5.f, 200.f)), "AudioRateDetector 5 V 200 Hz is audio", 0.0, 0.0);
+  venomTest::check(detect(sine(0.01f, 200.f)), "AudioRateDetector 10 mV 200 Hz is audio", 0.0, 0.0);
+  venomTest::check(detect(sine(0.01f, 200.f), 192000.f), "AudioRateDetector 10 mV 200 Hz at 192 kHz is audio", 0.0, 0.0);
+  venomTest::check(!detect(sine(10.f, 5.f)), "AudioRateDetector 10 V 5 Hz is slow", 0.0, 0.0);
+  venomTest::check(!detect(sine(0.01f, 5.f)), "AudioRateDetector 10 mV 5 Hz is slow", 0.0, 0.0);
+  venomTest::check(!detect([](int c, float t){return c * 2.5f;}), "AudioRateDetector constant is slow", 0.0, 0.0);
+  // A quiet audio rate channel is found beside a loud slow one
+  venomTest::check(detect([](int c, float t){return c ? 10.f * std::sin(2.f * M_PI * 2.f * t) : 0.005f * std::sin(2.f * M_PI * 500.f * t);}),
+    "AudioRateDetector quiet audio beside loud LFO is audio", 0.0, 0.0);
+
+  // A reset detector reports audio until its estimates settle
+  AudioRateDetector d;
+  engine::Input in;
+  in.channels = 1;
+  in.voltages[0] = 3.f;
+  bool early = d.process(in, 48000.f);
+  for (int i=0; i<4800; i++)
+    d.process(in, 48000.f);
+  venomTest::check(early && !d.audio, "AudioRateDetector reset reports audio until settled", 0.0, 0.0);
+}
+
+VENOM_TEST(smartPathSelectorTest) {
+  const float sr = 48000.f;
+  const int hold = static_cast<int>(SmartPathSelector().holdTime * sr);
+  SmartPathSelector sel;
+  sel.start(0);
+  bool up = sel.process(2, sr);
+  venomTest::check(up && sel.path == 2 && sel.prev == 0 && sel.fade == SmartPathSelector::fadeLen,
+    "SmartPathSelector takes a costlier path at once", 0.0, 0.0);
+  for (int i=0; i<100; i++)
+    sel.process(2, sr);
+  bool down = sel.process(0, sr);
+  venomTest::check(!down && sel.path == 2 && sel.fade == SmartPathSelector::fadeLen - 101,
+    "SmartPathSelector holds the costlier path", 0.0, 0.0);
+  int fade = sel.fade;
+  sel.process(0, sr);
+  sel.process(2, sr);
+  venomTest::check(sel.path == 2 && sel.fade == fade - 2, "SmartPathSelector hold restarts when wanted again", 0.0, 0.0);
+  int wait = 0;
+  while (sel.path == 2 && wait <= hold)
+    wait += !sel.process(0, sr);
+  venomTest::check(sel.path == 0 && wait == hold && sel.fade == SmartPathSelector::fadeLen,
+    "SmartPathSelector takes a cheaper path after the hold", wait, hold);
+  for (int i=0; i<100; i++)
+    sel.process(0, sr);
+  fade = sel.fade;
+  up = sel.process(2, sr);
+  venomTest::check(!up && sel.path == 2 && sel.prev == 0 && sel.fade == SmartPathSelector::fadeLen - fade + 1,
+    "SmartPathSelector reverses a crossfade without waiting for it", 0.0, 0.0);
+
+  // Net saving on enveloped level CV, with the cost of ShapedVCA x4 oversampling with
+  // 10th order filters as the full path, and a delayed gain as the path that is not oversampled.
+  // Every sample pays for the detector, and a crossfade pays for both paths.
+  const int over = 4, n = 1 << 18;
+  OversampleFilter_4 levelUp, audioUp, leftDown, rightDown;
+  levelUp.setOversample(over, 5);
+  audioUp.setOversample(over, 5);
+  leftDown.setOversample(over, 5);
+  rightDown.setOversample(over, 5);
+  simd::float_4 acc = 0.f, delay[8]{};
+  double start = venomTest::getTime();
+  for (int i=0; i<n; i++) {
+    simd::float_4 level = i & 7, audio = i & 3;
+    for (int o=0; o<over; o++) {
+      simd::float_4 gain = audioUp.process(o ? 0.f : audio * over) * simd::clamp(levelUp.process(o ? 0.f : level * over), 0.f, 1.f);
+      acc += leftDown.process(gain) + rightDown.process(gain);
+    }
+  }
+  double fullCost = venomTest::getTime() - start;
+  start = venomTest::getTime();
+  for (int i=0; i<n; i++) {
+    simd::float_4 level = i & 7, audio = i & 3;
+    delay[i & 7] = audio * simd::clamp(level, 0.f, 1.f);
+    acc += delay[(i - 3) & 7];
+  }
+  double plainCost = venomTest::getTime() - start;
+  AudioRateDetector detector;
+  engine::Input in;
+  in.channels = 1;
+  start = venomTest::getTime();
+  for (int i=0; i<n; i++) {
+    in.voltages[0] = i & 7;
+    acc += simd::float_4(detector.process(in, sr));
+  }
+  double detectCost = venomTest::getTime() - start;
+  venomTest::sink = acc[0];
+  venomTest::report("SmartPathSelector costs: full path %.1f ns, plain path %.1f ns, detector %.1f ns per sample",
+    fullCost * 1e9 / n, plainCost * 1e9 / n, detectCost * 1e9 / n);
+
+  struct Envelope {float rate, attack, decay, noise;};
+  for (Envelope e : {Envelope{1.f, 0.001f, 0.08f, 0.f}, Envelope{2.f, 0.001f, 0.3f, 0.f}, Envelope{4.f, 0.005f, 0.05f, 0.f},
+                     Envelope{2.f, 0.01f, 0.5f, 0.01f}, Envelope{1.f, 0.002f, 1.f, 0.005f}}) {
+    AudioRateDetector d;
+    SmartPathSelector s;
+    s.start(2);
+    double cost = 0.0;
+    int changes = 0, len = static_cast<int>(sr * 10.f);
+    uint32_t seed = 1;
+    for (int i=0; i<len; i++) {
+      float t = std::fmod(i * e.rate / sr, 1.f) / e.rate;
+      seed = seed * 1664525u + 1013904223u;
+      float noise = ((seed >> 8) / 16777216.f - 0.5f) * e.noise;
+      in.voltages[0] = 10.f * (t < e.attack ? t / e.attack : std::exp((e.attack - t) / e.decay)) + noise;
+      changes += s.process(d.process(in, sr) ? 2 : 0, sr);
+      cost += (s.path ? fullCost : plainCost) + (s.fade ? (s.prev ? fullCost : plainCost) : 0.0) + detectCost;
+    }
+    char name[100];
+    std::snprintf(name, sizeof name, "SmartPathSelector saves on %.0f Hz %.0f/%.0f ms env%s",
+                  e.rate, e.attack * 1e3, e.decay * 1e3, e.noise ? " + noise" : "");
+    venomTest::checkMax(name, cost / (len * fullCost), 1.0);
+    venomTest::report("  relative cost %.3f, %d path changes", cost / (len * fullCost), changes);
+  }
+}
@@ -0,0 +1,245 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+// Accuracy and throughput of the math.hpp approximations.
+// Each kernel is checked against the std:: version, and its error and speed are reported beside
+// candidate replacements (minimax polynomials fit to the same interval, and linearly interpolated lookup tables).
+
+#include "../test.hpp"
+#include "../../src/math.hpp"
+#include <functional>
+
+using simd::float_4;
+
+namespace {
+
+const int benchCount = 1 << 22;
+const int lutSize = 1024;
+
+///////////////////////////
+// Candidate alternatives
+
+// Odd minimax polynomials for sin(PI*t), t in [-0.5, 0.5]
+template <typename T>
+T sinPi_minimax5(T t) {
+  T t2 = t * t;
+  return ((2.29954717f * t2 - 5.13690528f) * t2 + 3.14064004f) * t;
+}
+
+template <typename T>
+T sinPi_minimax7(T t) {
+  T t2 = t * t;
+  return (((-0.554636182f * t2 + 2.54189902f) * t2 - 5.16714280f) * t2 + 3.14158202f) * t;
+}
+
+template <typename T>
+T sinPi_minimax9(T t) {
+  T t2 = t * t;
+  return ((((0.0772201665f * t2 - 0.598045195f) * t2 + 2.55003138f) * t2 - 5.16770688f) * t2 + 3.14159258f) * t;
+}
+
+// Minimax polynomial for 2^x with x in [0, 1), relative error about 7.5e-8
+template <typename T>
+T exp2_minimax5(T x) {
+  T xi = simd::floor(x);
+  T xf = x - xi;
+  T y = ((((0.00187757456f * xf + 0.00898934527f) * xf + 0.0558263136f) * xf + 0.240153619f) * xf + 0.693153073f) * xf + 0.999999925f;
+  return y * simd::pow(2.f, xi);
+}
+
+// Lambert continued fraction for tanh truncated to a 7/6 rational
+template <typename T>
+T tanh_rational7(T x) {
+  T x2 = x * x;
+  return simd::ifelse(
+    simd::fabs(x) >= static_cast<T>(5.f),
+    simd::sgn(x),
+    x * (((x2 + 378.f) * x2 + 17325.f) * x2 + 135135.f) / (((28.f * x2 + 3150.f) * x2 + 62370.f) * x2 + 135135.f)
+  );
+}
+
+// Linear interpolation table spanning [lo, hi], clamped at the ends
+struct LinearLut {
+  float lo, hi, scale;
+  float table[lutSize + 1];
+
+  LinearLut(float pLo, float pHi, std::function<double(double)> f) {
+    lo = pLo;
+    hi = pHi;
+    scale = lutSize / (hi - lo);
+    for (int i=0; i<=lutSize; i++)
+      table[i] = f(lo + i / scale);
+  }
+
+  float operator()(float x) const {
+    float pos = math::clamp((x - lo) * scale, 0.f, lutSize - 0.001f);
+    int i = static_cast<int>(pos);
+    float frac = pos - i;
+    return table[i] + (table[i+1] - table[i]) * frac;
+  }
+
+  float_4 operator()(float_4 x) const {
+    float_4 out;
+    for (int i=0; i<4; i++)
+      out[i] = (*this)(x[i]);
+    return out;
+  }
+};
+
+///////////////////////////
+// Measurement
+
+// Maximum absolute (or relative) error across a dense sweep of [lo, hi]
+double maxError(std::function<float(float)> f, std::function<double(double)> ref, float lo, float hi, bool relative = false) {
+  double err = 0.0;
+  const int steps = 100000;
+  for (int i=0; i<=steps; i++) {
+    float x = static_cast<float>(lo + static_cast<double>(hi - lo) * i / steps);
+    double r = ref(x);
+    double e = std::fabs(f(x) - r);
+    if (relative && r != 0.0)
+      e /= std::fabs(r);
+    err = std::max(err, e);
+  }
+  return err;
+}
+
+// Maximum error of a float_4 kernel, with a different value in each lane and every lane checked
+double maxError4(std::function<float_4(float_4)> f, std::function<double(double)> ref, float lo, float hi) {
+  double err = 0.0;
+  const int steps = 100000;
+  for (int i=0; i<=steps; i+=4) {
+    float_4 x;
+    for (int j=0; j<4; j++)
+      x[j] = static_cast<float>(lo + static_cast<double>(hi - lo) * std::min(i + j, steps) / steps);
+    float_4 y = f(x);
+    for (int j=0; j<4; j++)
+      err = std::max(err, std::fabs(y[j] - ref(x[j])));
+  }
+  return err;
+}
+
+// Nanoseconds per value, amortized across the SIMD lanes of T
+template <typename T, typename F>
+double nsPerValue(F f, float lo, float hi) {
+  const int lanes = sizeof(T) / sizeof(float);
+  const float step = (hi - lo) / benchCount;
+  T x, sum = 0.f;
+  for (int i=0; i<lanes; i++)
+    reinterpret_cast<float*>(&x)[i] = lo + i * step;
+  double start = venomTest::getTime();
+  for (int i=0; i<benchCount; i+=lanes) {
+    sum += f(x);
+    x += step * lanes;
+  }
+  double time = venomTest::getTime() - start;
+  float total = 0.f;
+  for (int i=0; i<lanes; i++)
+    total += reinterpret_cast<float*>(&sum)[i];
+  venomTest::sink = total;
+  return time * 1e9 / benchCount;
+}
+
+void report(const char* name, double err, double nsFloat, double nsSimd) {
+  if (nsFloat > 0.0 && nsSimd > 0.0)
+    venomTest::report("%-24s max error %.3e  float %6.2f ns  float_4 %6.2f ns/value", name, err, nsFloat, nsSimd);
+  else if (nsFloat > 0.0)
+    venomTest::report("%-24s max error %.3e  float %6.2f ns", name, err, nsFloat);
+  else
+    venomTest::report("%-24s max error %.3e  float_4 %6.2f ns/value", name, err, nsSimd);
+}
+
+double cosCycle(double t) {
+  return -std::cos(2.0 * M_PI * t);
+}
+
+} // namespace
+
+VENOM_TEST(tanhTest) {
+  auto ref = [](double x){return std::tanh(x);};
+  double err = maxError([](float x){return tanh_rational5(x);}, ref, -6.f, 6.f);
+  venomTest::checkMax("tanh_rational5 vs std::tanh", err, 0.024);
+  venomTest::checkMax("tanh_rational5 float_4 vs std::tanh", maxError4([](float_4 x){return tanh_rational5(x);}, ref, -6.f, 6.f), 0.024);
+  venomTest::checkMax("tanh_rational5 saturates at 3", std::fabs(tanh_rational5(3.f) - 1.f) + std::fabs(tanh_rational5(-4.f) + 1.f), 0.0);
+  venomTest::checkMax("softClip vs 10*tanh(x/9.5)", maxError([](float x){return softClip(x);}, [](double x){return 10.0 * std::tanh(x / 9.5);}, -30.f, 30.f), 0.24);
+
+  LinearLut lut(-5.f, 5.f, ref);
+  report("tanh_rational5", err,
+         nsPerValue<float>([](float x){return tanh_rational5(x);}, -5.f, 5.f),
+         nsPerValue<float_4>([](float_4 x){return tanh_rational5(x);}, -5.f, 5.f));
+  report("  tanh_rational7", maxError([](float x){return tanh_rational7(x);}, ref, -6.f, 6.f),
+         nsPerValue<float>([](float x){return tanh_rational7(x);}, -5.f, 5.f),
+         nsPerValue<float_4>([](float_4 x){return tanh_rational7(x);}, -5.f, 5.f));
+  report("  tanh LUT linear", maxError([&](float x){return lut(x);}, ref, -5.f, 5.f),
+         nsPerValue<float>([&](float x){return lut(x);}, -5.f, 5.f),
+         nsPerValue<float_4>([&](float_4 x){return lut(x);}, -5.f, 5.f));
+  report("  std::tanh", 0.0,
+         nsPerValue<float>([](float x){return std::tanh(x);}, -5.f, 5.f), 0.0);
+  report("softClip", maxError([](float x){return softClip(x);}, [](double x){return 10.0 * std::tanh(x / 9.5);}, -30.f, 30.f),
+         nsPerValue<float>([](float x){return softClip(x);}, -30.f, 30.f),
+         nsPerValue<float_4>([](float_4 x){return softClip(x);}, -30.f, 30.f));
+}
+
+VENOM_TEST(sineTest) {
+  double err = maxError([](float t){return sin_01(t);}, cosCycle, 0.f, 1.f);
+  venomTest::checkMax("sin_01 vs -cos", err, 1e-5);
+  // The float_4 kernel runs on the [0, 1000) phasor, and must agree with sin_01 in every lane
+  auto simdRef = [](double t){return -cosCycle(t / 1000.0);};
+  double errSimd = maxError4([](float_4 t){return sinSimd_1000(t);}, simdRef, 0.f, 1000.f);
+  venomTest::checkMax("sinSimd_1000 float_4 vs cos", errSimd, 1e-5);
+  venomTest::checkMax("sinSimd_1000 float_4 vs sin_01",
+    maxError4([](float_4 t){return sinSimd_1000(t);}, [](double t){return -sin_01(static_cast<float>(t / 1000.0));}, 0.f, 1000.f), 1e-5);
+
+  LinearLut lut(0.f, 1.f, cosCycle);
+  auto sinPiRef = [](double t){return std::sin(M_PI * t);};
+  report("sin_01", err,
+         nsPerValue<float>([](float t){return sin_01(t);}, 0.f, 1.f), 0.0);
+  report("sinSimd_1000", errSimd,
+         0.0, nsPerValue<float_4>([](float_4 t){return sinSimd_1000(t);}, 0.f, 1000.f));
+  report("  sinPi_minimax5", maxError([](float t){return sinPi_minimax5(t);}, sinPiRef, -0.5f, 0.5f),
+         nsPerValue<float>([](float t){return sinPi_minimax5(t);}, -0.5f, 0.5f),
+         nsPerValue<float_4>([](float_4 t){return sinPi_minimax5(t);}, -0.5f, 0.5f));
+  report("  sinPi_minimax7", maxError([](float t){return sinPi_minimax7(t);}, sinPiRef, -0.5f, 0.5f),
+         nsPerValue<float>([](float t){return sinPi_minimax7(t);}, -0.5f, 0.5f),
+         nsPerValue<float_4>([](float_4 t){return sinPi_minimax7(t);}, -0.5f, 0.5f));
+  report("  sinPi_minimax9", maxError([](float t){return sinPi_minimax9(t);}, sinPiRef, -0.5f, 0.5f),
+         nsPerValue<float>([](float t){return sinPi_minimax9(t);}, -0.5f, 0.5f),
+         nsPerValue<float_4>([](float_4 t){return sinPi_minimax9(t);}, -0.5f, 0.5f));
+  report("  sine LUT linear", maxError([&](float t){return lut(t);}, cosCycle, 0.f, 1.f),
+         nsPerValue<float>([&](float t){return lut(t);}, 0.f, 1.f),
+         nsPerValue<float_4>([&](float_4 t){return lut(t);}, 0.f, 1.f));
+  report("  std::sin", 0.0,
+         nsPerValue<float>([](float t){return std::sin(t);}, -0.5f, 0.5f),
+         nsPerValue<float_4>([](float_4 t){return simd::sin(t);}, -0.5f, 0.5f));
+}
+
+VENOM_TEST(normSigmoidTest) {
+  // normSigmoid is exact, so only its fixed points are checked
+  double err = 0.0;
+  for (float k=-0.99f; k<=0.99f; k+=0.01f)
+    err = std::max(err, static_cast<double>(std::fabs(normSigmoid(1.f, k) - 1.f) + std::fabs(normSigmoid(-1.f, k) + 1.f) + std::fabs(normSigmoid(0.f, k))));
+  venomTest::checkMax("normSigmoid fixed points", err, 1e-6);
+  report("normSigmoid", 0.0,
+         nsPerValue<float>([](float x){return normSigmoid(x, -0.5f);}, -1.f, 1.f),
+         nsPerValue<float_4>([](float_4 x){return normSigmoid(x, -0.5f);}, -1.f, 1.f));
+}
+
+VENOM_TEST(exp2Test) {
+  // Relative error across the V/Oct range
+  auto ref = [](double x){return std::exp2(x);};
+  double err = maxError([](float x){return dsp::exp2_taylor5(x);}, ref, -10.f, 10.f, true);
+  venomTest::checkMax("dsp::exp2_taylor5 relative vs std::exp2", err, 2e-7);
+  LinearLut lut(-10.f, 10.f, ref);
+  report("dsp::exp2_taylor5", err,
+         nsPerValue<float>([](float x){return dsp::exp2_taylor5(x);}, -10.f, 10.f),
+         nsPerValue<float_4>([](float_4 x){return dsp::exp2_taylor5(x);}, -10.f, 10.f));
+  report("  exp2_minimax5", maxError([](float x){return exp2_minimax5(x);}, ref, -10.f, 10.f, true),
+         nsPerValue<float>([](float x){return exp2_minimax5(x);}, -10.f, 10.f),
+         nsPerValue<float_4>([](float_4 x){return exp2_minimax5(x);}, -10.f, 10.f));
+  report("  exp2 LUT linear", maxError([&](float x){return lut(x);}, ref, -10.f, 10.f, true),
+         nsPerValue<float>([&](float x){return lut(x);}, -10.f, 10.f),
+         nsPerValue<float_4>([&](float_4 x){return lut(x);}, -10.f, 10.f));
+  report("  std::exp2", 0.0,
+         nsPerValue<float>([](float x){return std::exp2(x);}, -10.f, 10.f),
+         nsPerValue<float_4>([](float_4 x){return simd::pow(2.f, x);}, -10.f, 10.f));
+}
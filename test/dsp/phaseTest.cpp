@@ -0,0 +1,38 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+// Checks of the math.hpp oscillator phase helpers
+
+#include "../test.hpp"
+#include "../../src/math.hpp"
+
+using simd::float_4;
+using simd::int32_4;
+
+VENOM_TEST(phase32Test) {
+  // Round trip of phasor offsets of any magnitude, compared as the circular distance within the [0, 1000) cycle
+  double err = 0.0;
+  for (float x=-5000.f; x<=5000.f; x+=0.37f) {
+    float_4 in(x, x + 0.1f, -x, x * 0.5f);
+    float_4 out = phase32ToPhasor(phasorToPhase32(in));
+    for (int i=0; i<4; i++) {
+      double want = std::fmod(static_cast<double>(in[i]), 1000.0);
+      if (want < 0.0)
+        want += 1000.0;
+      double d = std::fabs(out[i] - want);
+      err = std::max(err, std::min(d, 1000.0 - d));
+    }
+  }
+  venomTest::checkMax("phase32 round trip", err, 1e-3);
+
+  // Accumulating a fixed increment wraps for free and never drifts: after whole cycles the phase returns exactly
+  int32_4 phase = 0;
+  int32_4 inc = phasorToPhase32(float_4(1000.f / 256.f));
+  for (int i=0; i<256 * 10000; i++)
+    phase += inc;
+  venomTest::checkMax("phase32 accumulation drift", std::fabs(phase32ToPhasor(phase)[0]), 0.0);
+
+  // An offset added to the phase wraps into [0, 1000)
+  float_4 p = phase32Phasor(phasorToPhase32(float_4(900.f)), float_4(250.f));
+  venomTest::checkMax("phase32Phasor wrap", std::fabs(p[0] - 150.f), 1e-3);
+}
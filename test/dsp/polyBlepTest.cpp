@@ -0,0 +1,40 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+// Checks of the math.hpp polyBLEP and polyBLAMP residuals
+
+#include "../test.hpp"
+#include "../../src/math.hpp"
+
+using simd::float_4;
+
+VENOM_TEST(polyBlepTest) {
+  char name[80];
+  float dts[3]{0.1f, 0.01f, 1e-3f};
+  for (float dt : dts) {
+    // A naive unit step plus its residual is continuous across the step at phase 0
+    auto step = [&](float t) {return (t < 0.5f ? 1.f : 0.f) + polyBlep(float_4(t), float_4(dt))[0];};
+    float e = dt * 1e-3f;
+    std::snprintf(name, sizeof(name), "polyBlep continuity dt=%g", dt);
+    venomTest::checkMax(name, std::fabs(step(e) - step(1.f - e)), 3e-3);
+
+    // The residual is zero more than one sample from the step
+    float t = 1.5f * dt;
+    std::snprintf(name, sizeof(name), "polyBlep/polyBlamp support dt=%g", dt);
+    venomTest::checkMax(name, std::fabs(polyBlep(float_4(t), float_4(dt))[0]) + std::fabs(polyBlep(float_4(1.f - t), float_4(dt))[0]) +
+      std::fabs(polyBlamp(float_4(t), float_4(dt))[0]) + std::fabs(polyBlamp(float_4(1.f - t), float_4(dt))[0]), 0.0);
+
+    // The residuals are odd (step) and even (ramp) about the discontinuity, so they add no DC
+    double sumBlep = 0.0, sumBlamp = 0.0;
+    int n = 1000;
+    for (int i=0; i<n; i++) {
+      float u = (i + 0.5f) / n * dt;
+      sumBlep += polyBlep(float_4(u), float_4(dt))[0] + polyBlep(float_4(1.f - u), float_4(dt))[0];
+      sumBlamp += polyBlamp(float_4(u), float_4(dt))[0] - polyBlamp(float_4(1.f - u), float_4(dt))[0];
+    }
+    std::snprintf(name, sizeof(name), "polyBlep odd symmetry dt=%g", dt);
+    venomTest::checkMax(name, std::fabs(sumBlep) / n, 1e-6);
+    std::snprintf(name, sizeof(name), "polyBlamp even symmetry dt=%g", dt);
+    venomTest::checkMax(name, std::fabs(sumBlamp) / n, 1e-9);
+  }
+}
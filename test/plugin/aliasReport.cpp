@@ -0,0 +1,169 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+// Aliasing and CPU report for VCO Lab and VCO Unit, run with `make alias-report`.
+// Each wave and shape mode is rendered by a fresh module instance at a sweep of pitches,
+// oversample rates, and oversample filter orders. The alias level is the energy of every
+// spectral bin that is not DC or a harmonic of the fundamental, relative to the energy of
+// the fundamental.
+
+#include "pluginEnv.hpp"
+#include <functional>
+
+using namespace venomTest;
+
+namespace {
+
+const float sampleRate = 48000.f;
+const int fftSize = 16384;
+const int settleSamples = 4096;
+const int windowBins = 4; // main lobe half width of the Blackman-Harris window
+const float pitches[] = {-2.f, 0.f, 1.f, 2.f, 3.f, 3.5f}; // V/Oct relative to C4
+const char* overNames[] = {"x1", "x2", "x4", "x8", "x16", "x32"};
+
+struct AliasCase {
+  std::string name;
+  int outputId;
+  std::function<void(Module*, float)> setup; // sets the wave and shape params, and the V/Oct pitch
+};
+
+struct AliasResult {
+  double aliasDb;
+  double nsPerSample;
+};
+
+AliasResult measure(Model* model, const AliasCase& c, float voct, int over, int stages) {
+  Module* m = model->createModule();
+  VenomModule* vm = static_cast<VenomModule*>(m);
+  m->outputs[c.outputId].setChannels(1);
+  c.setup(m, voct);
+  // The module is not added to a running engine, so it gets the sample rate event here instead
+  Module::SampleRateChangeEvent e;
+  e.sampleRate = sampleRate;
+  e.sampleTime = 1.f / sampleRate;
+  m->onSampleRateChange(e);
+  Module::ProcessArgs args{sampleRate, 1.f / sampleRate, 0};
+  m->process(args); // applies the mode, which also sets the default oversample rate
+  m->params[paramId(m, "Oversample")].setValue(over);
+  vm->oversampleStages = stages;
+  vm->setOversample();
+
+  std::vector<float> renderMem(fftSize + 4), specMem(fftSize + 4);
+  float* render = dsp::alignPtr(renderMem.data());
+  float* spec = dsp::alignPtr(specMem.data());
+  double start = getTime();
+  for (int i=0; i<settleSamples+fftSize; i++) {
+    args.frame = i + 1;
+    m->process(args);
+    if (i >= settleSamples)
+      render[i - settleSamples] = m->outputs[c.outputId].getVoltage();
+  }
+  double time = getTime() - start;
+  delete m;
+
+  // 4 term Blackman-Harris window, sidelobes below -92 dB
+  for (int i=0; i<fftSize; i++) {
+    double x = 2.0 * M_PI * i / fftSize;
+    render[i] *= 0.35875 - 0.48829 * std::cos(x) + 0.14128 * std::cos(2.0 * x) - 0.01168 * std::cos(3.0 * x);
+  }
+  dsp::RealFFT fft(fftSize);
+  fft.rfft(render, spec);
+
+  // Classify bins as DC, fundamental, other harmonic, or alias
+  const int bins = fftSize / 2;
+  std::vector<int> binClass(bins, 3); // 0 = DC, 1 = fundamental, 2 = harmonic, 3 = alias
+  for (int k=0; k<=windowBins; k++)
+    binClass[k] = 0;
+  double f0Bin = dsp::FREQ_C4 * std::pow(2.0, voct) * fftSize / sampleRate;
+  for (int h=1; h*f0Bin < bins; h++) {
+    int center = static_cast<int>(std::round(h * f0Bin));
+    for (int k=std::max(center - windowBins, 0); k<=std::min(center + windowBins, bins - 1); k++)
+      binClass[k] = std::min(binClass[k], h==1 ? 1 : 2);
+  }
+  double energy[4]{};
+  for (int k=1; k<bins; k++)
+    energy[binClass[k]] += spec[2*k] * spec[2*k] + spec[2*k+1] * spec[2*k+1];
+
+  AliasResult result;
+  result.aliasDb = 10.0 * std::log10((energy[3] + 1e-30) / (energy[1] + 1e-30));
+  result.nsPerSample = time * 1e9 / (settleSamples + fftSize);
+  return result;
+}
+
+void aliasReport(Model* model, const std::vector<AliasCase>& cases) {
+  report("%s at %.0f Hz sample rate, alias energy relative to the fundamental", model->name.c_str(), sampleRate);
+  for (const AliasCase& c : cases) {
+    for (float voct : pitches) {
+      double freq = dsp::FREQ_C4 * std::pow(2.0, voct);
+      if (freq >= sampleRate / 2.f)
+        continue;
+      for (int over=0; over<6; over++) {
+        // The filter order is irrelevant without oversampling
+        for (int stages = over ? 3 : 5; stages<=5; stages++) {
+          AliasResult r = measure(model, c, voct, over, stages);
+          report("%-36s %7.1f Hz  %-3s  %-10s  alias %6.1f dB  %7.1f ns/sample",
+                 c.name.c_str(), freq, overNames[over], over ? (std::to_string(stages * 2) + "th order").c_str() : "",
+                 r.aliasDb, r.nsPerSample);
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+VENOM_REPORT(aliasReportVCOLab) {
+  initPlugin();
+  // Every mode of every wave, each on its own output. The Mix cases sum all 4 waves at half level.
+  Module* m = modelOscillator->createModule();
+  std::string xStr[5]{"Sine", "Triangle", "Square", "Saw", "Mix"};
+  int freqId = paramId(m, "Frequency");
+  std::vector<AliasCase> cases;
+  for (int x=0; x<5; x++) {
+    int modeId = paramId(m, xStr[x]+" Shape Mode");
+    int shapeId = paramId(m, xStr[x]+" shape");
+    int levelId[5];
+    for (int w=0; w<5; w++)
+      levelId[w] = paramId(m, xStr[w]+" level");
+    SwitchQuantity* q = static_cast<SwitchQuantity*>(m->paramQuantities[modeId]);
+    for (size_t mode=0; mode<q->labels.size(); mode++) {
+      cases.push_back({xStr[x]+" "+q->labels[mode], outputId(m, xStr[x]), [=](Module* osc, float voct) {
+        osc->params[freqId].setValue(voct);
+        osc->params[modeId].setValue(mode);
+        osc->params[shapeId].setValue(x==4 ? 0.f : 0.5f);
+        if (x==4) {
+          for (int w=0; w<4; w++)
+            osc->params[levelId[w]].setValue(0.5f);
+          osc->params[levelId[4]].setValue(1.f);
+        }
+      }});
+    }
+  }
+  delete m;
+  aliasReport(modelOscillator, cases);
+}
+
+VENOM_REPORT(aliasReportVCOUnit) {
+  initPlugin();
+  Module* m = modelVCOUnit->createModule();
+  std::string waveStr[4]{"Sine", "Triangle", "Square", "Saw"};
+  std::vector<std::string> modeStr = {"log/exp", "J-curve", "S-curve", "Rectify", "Normalized Rectify", "Morph"};
+  std::vector<std::string> sqrModeStr = {"Limited PWM", "Full PWM", "Morph"};
+  int freqId = paramId(m, "Frequency"), waveId = paramId(m, "Waveform");
+  int modeId = paramId(m, "Shape Mode"), shapeId = paramId(m, "Shape");
+  int out = outputId(m, "");
+  std::vector<AliasCase> cases;
+  for (int w=0; w<4; w++) {
+    std::vector<std::string>& modes = w==2 ? sqrModeStr : modeStr;
+    for (int mode=0; mode<static_cast<int>(modes.size()); mode++) {
+      cases.push_back({waveStr[w]+" "+modes[mode], out, [=](Module* vco, float voct) {
+        vco->params[freqId].setValue(voct);
+        vco->params[waveId].setValue(w);
+        vco->params[modeId].setValue(mode);
+        vco->params[shapeId].setValue(0.5f);
+      }});
+    }
+  }
+  delete m;
+  aliasReport(modelVCOUnit, cases);
+}
@@ -0,0 +1,71 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+// Patch load scalability benchmark. For every Venom module, synthetic patches of 10, 100,
+// and 1000 instances are loaded into an engine that is never started, and the time per
+// instance of each load stage is reported. A per instance time that grows with the instance
+// count points to a stage that scales super-linearly, such as the Widget Menu Extender scan
+// of every module in the patch.
+//
+// Module widgets need a window, so widget construction is represented by its main uncached
+// cost, the parse of the panel SVG, which Rack does once per panel file.
+
+#include "pluginEnv.hpp"
+
+using namespace venomTest;
+
+VENOM_TEST(patchLoadTest) {
+  initPlugin();
+  Module::ProcessArgs args{48000.f, 1.f / 48000.f, 0};
+  report("%-24s %5s  %-9s %-13s %-11s %-9s (us per instance)", "", "count", "create", "dataFromJson", "param init", "remove");
+  for (Model* model : pluginInstance->models) {
+    // Every instance loads the data a default instance saves
+    Module* m = model->createModule();
+    json_t* dataJ = m->dataToJson();
+    delete m;
+    for (int n=10; n<=1000; n*=10) {
+      std::vector<Module*> mods(n);
+      double t0 = getTime();
+      for (int i=0; i<n; i++) {
+        mods[i] = model->createModule();
+        APP->engine->addModule(mods[i]);
+      }
+      double t1 = getTime();
+      if (dataJ) {
+        for (int i=0; i<n; i++)
+          mods[i]->dataFromJson(dataJ);
+      }
+      double t2 = getTime();
+      // The param extensions are initialized by the first process() after the widget is drawn
+      for (int i=0; i<n; i++) {
+        VenomModule* vm = static_cast<VenomModule*>(mods[i]);
+        vm->drawn = true;
+        vm->VenomModule::process(args);
+      }
+      double t3 = getTime();
+      for (int i=0; i<n; i++) {
+        APP->engine->removeModule(mods[i]);
+        delete mods[i];
+      }
+      double t4 = getTime();
+      report("%-24s %5d  %9.2f %13.2f %11.2f %9.2f", model->slug.c_str(), n,
+             (t1-t0)*1e6/n, (t2-t1)*1e6/n, (t3-t2)*1e6/n, (t4-t3)*1e6/n);
+    }
+    if (dataJ)
+      json_decref(dataJ);
+  }
+
+  double total = 0.0;
+  for (Model* model : pluginInstance->models) {
+    std::string path = asset::plugin(pluginInstance, faceplatePath(model->slug, themes[0]));
+    if (!system::isFile(path))
+      continue;
+    double start = getTime();
+    window::Svg svg;
+    svg.loadFile(path);
+    double time = getTime() - start;
+    total += time;
+    report("%-24s panel SVG parse %8.1f us", model->slug.c_str(), time*1e6);
+  }
+  report("all panel SVG parses %8.1f ms", total*1e3);
+}
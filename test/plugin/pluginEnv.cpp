@@ -0,0 +1,43 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+#include "pluginEnv.hpp"
+#include <cstdlib>
+
+namespace venomTest {
+
+void initPlugin() {
+  static bool done = false;
+  if (done)
+    return;
+  done = true;
+  settings::devMode = true; // log to stderr instead of log.txt
+  logger::init();
+  random::init();
+  contextSet(new Context);
+  APP->engine = new engine::Engine;
+  Plugin* p = new Plugin;
+  p->slug = "VenomModules";
+  p->path = "."; // tests run from the repository root
+  init(p);
+}
+
+int paramId(Module* m, const std::string& name) {
+  for (int i=0; i<m->getNumParams(); i++) {
+    if (m->paramQuantities[i]->name == name)
+      return i;
+  }
+  std::fprintf(stderr, "%s has no param named %s\n", m->model->slug.c_str(), name.c_str());
+  std::exit(EXIT_FAILURE);
+}
+
+int outputId(Module* m, const std::string& name) {
+  for (int i=0; i<m->getNumOutputs(); i++) {
+    if (m->outputInfos[i]->name == name)
+      return i;
+  }
+  std::fprintf(stderr, "%s has no output named %s\n", m->model->slug.c_str(), name.c_str());
+  std::exit(EXIT_FAILURE);
+}
+
+} // namespace venomTest
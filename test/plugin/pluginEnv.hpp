@@ -0,0 +1,21 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+// Shared setup for test/plugin/, which creates the plugin's own modules outside of Rack.
+
+#pragma once
+#include "../test.hpp"
+#include "../../src/plugin.hpp"
+
+namespace venomTest {
+
+// Sets up just enough of Rack to create and run modules without a window or audio device:
+// logging to stderr, a context whose engine is never started, and the plugin's models.
+// Every case calls it, only the first call does anything.
+void initPlugin();
+
+// Id of the param or output with the given name, exits if the module has none
+int paramId(Module* m, const std::string& name);
+int outputId(Module* m, const std::string& name);
+
+} // namespace venomTest
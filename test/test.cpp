@@ -0,0 +1,53 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+#include "test.hpp"
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+
+namespace venomTest {
+
+static int failures = 0;
+volatile float sink;
+
+std::vector<Case>& cases() {
+  static std::vector<Case> list;
+  return list;
+}
+
+void check(bool ok, const char* name, double err, double tol) {
+  std::printf("%s %-52s err %.3g (tol %.3g)\n", ok ? "pass" : "FAIL", name, err, tol);
+  if (!ok)
+    failures++;
+}
+
+void checkMax(const char* name, double err, double tol) {
+  check(err <= tol, name, err, tol);
+}
+
+void report(const char* fmt, ...) {
+  std::va_list args;
+  va_start(args, fmt);
+  std::printf("     ");
+  std::vprintf(fmt, args);
+  std::printf("\n");
+  va_end(args);
+}
+
+} // namespace venomTest
+
+// Runs every registered case except the reports, or only those whose name contains one of the arguments
+int main(int argc, char** argv) {
+  for (venomTest::Case& c : venomTest::cases()) {
+    bool run = argc < 2 && !c.named;
+    for (int i=1; i<argc; i++)
+      run |= std::strstr(c.name, argv[i]) != nullptr;
+    if (!run)
+      continue;
+    std::printf("---- %s\n", c.name);
+    c.run();
+  }
+  std::printf("%d failure(s)\n", venomTest::failures);
+  return venomTest::failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
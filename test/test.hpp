@@ -0,0 +1,59 @@
+// Venom Modules (c) 2023, 2024 Dave Benham
+// Licensed under GNU GPLv3
+
+// Minimal test and benchmark harness shared by the programs built with `make test`.
+// Each test file registers its cases with VENOM_TEST, and test/test.cpp runs them in order.
+
+#pragma once
+#include "rack.hpp"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace rack;
+
+namespace venomTest {
+
+struct Case {
+  const char* name;
+  void (*run)();
+  bool named; // only run when named on the command line
+};
+
+std::vector<Case>& cases();
+
+struct Register {
+  Register(const char* name, void (*run)(), bool named = false) {
+    cases().push_back({name, run, named});
+  }
+};
+
+// Record a pass or failure. err and tol are only reported.
+void check(bool ok, const char* name, double err, double tol);
+
+// Pass when err does not exceed tol
+void checkMax(const char* name, double err, double tol);
+
+// Print a benchmark or measurement line, which never fails
+void report(const char* fmt, ...);
+
+// Monotonic time in seconds
+inline double getTime() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Keeps benchmark results alive so the compiler cannot discard the work
+extern volatile float sink;
+
+} // namespace venomTest
+
+#define VENOM_TEST(fn) \
+  static void fn(); \
+  static venomTest::Register fn##Register(#fn, fn); \
+  static void fn()
+
+// A slow report, only run when its name is given on the command line
+#define VENOM_REPORT(fn) \
+  static void fn(); \
+  static venomTest::Register fn##Register(#fn, fn, true); \
+  static void fn()